@@ -0,0 +1,633 @@
+#include <stdio.h>
+#include "BPlusTree.h"
+#include "Queue.h"
+#include "../OutputBuffer.h"
+
+//Constrói uma B+-árvore vazia, guardada em um arquivo temporário
+BPlusTree::BPlusTree(int order)
+{
+    file = new PageFile();
+    file->openTemporary(BTreeNode::pageSize(order));
+
+    open(order, DEFAULT_POOL_SIZE);
+}
+
+//Constrói uma B+-árvore em um arquivo temporário, com um buffer pool
+//de poolSize nós
+BPlusTree::BPlusTree(int order, int poolSize)
+{
+    file = new PageFile();
+    file->openTemporary(BTreeNode::pageSize(order));
+
+    open(order, poolSize);
+}
+
+//Constrói uma B+-árvore persistente no arquivo fileName
+BPlusTree::BPlusTree(int order, const char* fileName)
+{
+    file = new PageFile();
+    file->open(fileName, BTreeNode::pageSize(order));
+
+    open(order, DEFAULT_POOL_SIZE);
+}
+
+//Constrói uma B+-árvore persistente no arquivo fileName, com um
+//buffer pool de poolSize nós
+BPlusTree::BPlusTree(int order, const char* fileName, int poolSize)
+{
+    file = new PageFile();
+    file->open(fileName, BTreeNode::pageSize(order));
+
+    open(order, poolSize);
+}
+
+//Cria o buffer pool e carrega a raiz do arquivo ou, se o arquivo
+//é novo, cria uma raiz vazia. A raiz fica fixada enquanto for raiz
+void BPlusTree::open(int order, int poolSize)
+{
+    root = 0;
+
+    if (file->rootPage != 0)
+    {
+        t = file->order;
+        numberOfKeys = file->numberOfKeys;
+
+        pool = new BufferPool(file, t, poolSize);
+        root = DISK_READ(file->rootPage);
+    }
+    else
+    {
+        t = order;
+        numberOfKeys = 0;
+        file->order = t;
+
+        pool = new BufferPool(file, t, poolSize);
+
+        BTreeNode* node = allocateNode();
+
+        setRoot(node);
+        release(node);
+    }
+}
+
+//Destrói a B+-árvore, gravando os nós sujos e o cabeçalho do arquivo
+BPlusTree::~BPlusTree()
+{
+    file->numberOfKeys = numberOfKeys;
+
+    delete pool;
+    delete file;
+}
+
+//Grava no arquivo todos os nós alterados que estão no buffer pool
+void BPlusTree::flush()
+{
+    file->numberOfKeys = numberOfKeys;
+
+    pool->flush();
+}
+
+BufferPool* BPlusTree::getBufferPool()
+{
+    return pool;
+}
+
+int BPlusTree::size()
+{
+    return numberOfKeys;
+}
+
+//Obtém, fixado no buffer pool, o nó guardado na página id
+BTreeNode* BPlusTree::DISK_READ(int id)
+{
+    return pool->fetch(id);
+}
+
+//Marca o nó como alterado
+void BPlusTree::DISK_WRITE(BTreeNode* node)
+{
+    pool->markDirty(node);
+}
+
+//Desfaz a fixação de um nó obtido com DISK_READ ou allocateNode
+void BPlusTree::release(BTreeNode* node)
+{
+    if (node != 0)
+        pool->unpin(node);
+}
+
+//Cria, fixado, um nó vazio em uma nova página
+BTreeNode* BPlusTree::allocateNode()
+{
+    return pool->create(file->allocatePage());
+}
+
+//Devolve a página do nó ao arquivo e o retira do buffer pool
+void BPlusTree::freeNode(BTreeNode* node)
+{
+    int id = node->id;
+
+    pool->discard(node);
+    file->freePage(id);
+}
+
+//Troca a raiz da árvore; a nova raiz fica fixada
+void BPlusTree::setRoot(BTreeNode* node)
+{
+    pool->pin(node);
+
+    if (root != 0)
+        pool->unpin(root);
+
+    root = node;
+    file->rootPage = node->id;
+}
+
+//Retorna o filho de um nó interno por onde value deve ser
+//procurado: o primeiro cuja chave de roteamento é maior que value
+int BPlusTree::childIndex(BTreeNode* node, int value)
+{
+    int i = keySearch(node->key, node->n, value);
+
+    if (i < node->n && node->key[i] == value)
+        i++;
+
+    return i;
+}
+
+//Desce da raiz até a folha onde value está ou deveria estar.
+//Retorna a folha fixada
+BTreeNode* BPlusTree::findLeaf(int value)
+{
+    BTreeNode* node = DISK_READ(root->id);
+
+    while (!node->leaf)
+    {
+        BTreeNode* child = DISK_READ(node->c[childIndex(node, value)]);
+
+        release(node);
+        node = child;
+    }
+
+    return node;
+}
+
+//Busca uma chave na B+-árvore
+bool BPlusTree::search(int value)
+{
+    BTreeNode* leaf = findLeaf(value);
+
+    int i = keySearch(leaf->key, leaf->n, value);
+
+    bool found = i < leaf->n && value == leaf->key[i];
+
+    release(leaf);
+
+    return found;
+}
+
+//Retorna um percurso pelas chaves do intervalo [lo, hi], que deve
+//ser liberado com delete
+RangeScan* BPlusTree::scan(int lo, int hi)
+{
+    return new RangeScan(this, lo, hi);
+}
+
+//Insere uma nova chave, se ela ainda não existir
+bool BPlusTree::insert(int value)
+{
+    if (search(value))
+        return false;
+
+    doInsert(value);
+    numberOfKeys++;
+
+    return true;
+}
+
+//Inicia a inserção na raiz, quebrando-a antes se estiver cheia
+void BPlusTree::doInsert(int value)
+{
+    if (root->n == 2 * t - 1)
+    {
+        BTreeNode* s = allocateNode();
+        BTreeNode* y = root;
+
+        s->leaf = false;
+        s->n = 0;
+        s->c[0] = y->id;
+
+        BTreeNode* z = splitChild(s, 0, y);
+
+        setRoot(s);
+
+        release(z);
+        release(s);
+
+        insertNonFull(s, value);
+    }
+    else
+    {
+        insertNonFull(root, value);
+    }
+}
+
+//Quebra o nó cheio y, i-ésimo filho de x, em dois. Uma folha
+//mantém todas as chaves e copia para o pai a primeira chave da
+//nova folha; um nó interno sobe a mediana. Retorna o novo irmão
+//à direita de y, que deve ser devolvido com release
+BTreeNode* BPlusTree::splitChild(BTreeNode* x, int i, BTreeNode* y)
+{
+    BTreeNode* z = allocateNode();
+    int separator;
+
+    z->leaf = y->leaf;
+
+    if (y->leaf)
+    {
+        z->n = t;
+
+        for (int j = 0; j < t; j++)
+            z->key[j] = y->key[j + t - 1];
+
+        y->n = t - 1;
+
+        z->next = y->next;
+        y->next = z->id;
+
+        separator = z->key[0];
+    }
+    else
+    {
+        z->n = t - 1;
+
+        for (int j = 0; j < t - 1; j++)
+            z->key[j] = y->key[j + t];
+
+        for (int j = 0; j < t; j++)
+            z->c[j] = y->c[j + t];
+
+        y->n = t - 1;
+
+        separator = y->key[t - 1];
+    }
+
+    for (int j = x->n; j > i; j--)
+        x->c[j + 1] = x->c[j];
+
+    x->c[i + 1] = z->id;
+
+    for (int j = x->n - 1; j >= i; j--)
+        x->key[j + 1] = x->key[j];
+
+    x->key[i] = separator;
+    x->n++;
+
+    DISK_WRITE(y);
+    DISK_WRITE(z);
+    DISK_WRITE(x);
+
+    return z;
+}
+
+//Recursivamente, insere uma nova chave em um nó não cheio
+void BPlusTree::insertNonFull(BTreeNode* x, int value)
+{
+    if (x->leaf)
+    {
+        int pos = keySearch(x->key, x->n, value);
+
+        for (int i = x->n - 1; i >= pos; i--)
+            x->key[i + 1] = x->key[i];
+
+        x->key[pos] = value;
+        x->n++;
+
+        DISK_WRITE(x);
+    }
+    else
+    {
+        int i = childIndex(x, value);
+        BTreeNode* child = DISK_READ(x->c[i]);
+
+        if (child->n == 2 * t - 1)
+        {
+            BTreeNode* z = splitChild(x, i, child);
+
+            if (value >= x->key[i])
+            {
+                release(child);
+                child = z;
+            }
+            else
+                release(z);
+        }
+        insertNonFull(child, value);
+
+        release(child);
+    }
+}
+
+//Remove uma chave, se ela existir
+bool BPlusTree::remove(int value)
+{
+    if (!doRemove(root, value))
+        return false;
+
+    numberOfKeys--;
+
+    return true;
+}
+
+//Recursivamente, remove a chave da subárvore de x. Antes de descer,
+//garante que o filho tenha pelo menos t chaves, então a remoção
+//na folha nunca a deixa com menos de t - 1. As chaves de roteamento
+//não precisam ser corrigidas: continuam separando as subárvores.
+bool BPlusTree::doRemove(BTreeNode* x, int value)
+{
+    if (x->leaf)
+    {
+        int i = keySearch(x->key, x->n, value);
+
+        if (i == x->n || x->key[i] != value)
+            return false;
+
+        for (int j = i; j < x->n - 1; j++)
+            x->key[j] = x->key[j + 1];
+
+        x->n--;
+
+        DISK_WRITE(x);
+
+        return true;
+    }
+
+    int i = childIndex(x, value);
+    BTreeNode* y = DISK_READ(x->c[i]);
+
+    if (y->n == t - 1)
+        y = fill(x, i, y);
+
+    bool ret = doRemove(y, value);
+    release(y);
+
+    return ret;
+}
+
+//Garante que y, i-ésimo filho de x com t - 1 chaves, passe a ter
+//pelo menos t, emprestando de um irmão ou juntando-se a ele.
+//Retorna o nó por onde a remoção deve continuar, fixado. Pode
+//diminuir a altura da árvore
+BTreeNode* BPlusTree::fill(BTreeNode* x, int i, BTreeNode* y)
+{
+    BTreeNode* u = 0;
+    BTreeNode* z = 0;
+    BTreeNode* w;
+
+    if (i > 0)
+        u = DISK_READ(x->c[i - 1]);
+
+    if (i < x->n)
+        z = DISK_READ(x->c[i + 1]);
+
+    if (u != 0 && u->n > t - 1)
+    {
+        borrowLeft(x, i, u, y);
+
+        release(u);
+        release(z);
+
+        return y;
+    }
+
+    if (z != 0 && z->n > t - 1)
+    {
+        borrowRight(x, i, y, z);
+
+        release(u);
+        release(z);
+
+        return y;
+    }
+
+    if (z != 0)
+    {
+        merge(x, i, y, z);
+        release(u);
+
+        w = y;
+    }
+    else
+    {
+        merge(x, i - 1, u, y);
+
+        w = u;
+    }
+
+    if (x == root && x->n == 0)
+    {
+        setRoot(w);
+
+        freeNode(x);
+    }
+
+    return w;
+}
+
+//Passa a última chave de u, irmão à esquerda de y, para y
+void BPlusTree::borrowLeft(BTreeNode* x, int i, BTreeNode* u, BTreeNode* y)
+{
+    for (int j = y->n - 1; j >= 0; j--)
+        y->key[j + 1] = y->key[j];
+
+    if (y->leaf)
+    {
+        y->key[0] = u->key[u->n - 1];
+        x->key[i - 1] = y->key[0];
+    }
+    else
+    {
+        for (int j = y->n; j >= 0; j--)
+            y->c[j + 1] = y->c[j];
+
+        y->key[0] = x->key[i - 1];
+        y->c[0] = u->c[u->n];
+        x->key[i - 1] = u->key[u->n - 1];
+    }
+
+    y->n++;
+    u->n--;
+
+    DISK_WRITE(x);
+    DISK_WRITE(u);
+    DISK_WRITE(y);
+}
+
+//Passa a primeira chave de z, irmão à direita de y, para y
+void BPlusTree::borrowRight(BTreeNode* x, int i, BTreeNode* y, BTreeNode* z)
+{
+    if (y->leaf)
+    {
+        y->key[y->n] = z->key[0];
+
+        for (int j = 0; j < z->n - 1; j++)
+            z->key[j] = z->key[j + 1];
+
+        x->key[i] = z->key[0];
+    }
+    else
+    {
+        y->key[y->n] = x->key[i];
+        y->c[y->n + 1] = z->c[0];
+        x->key[i] = z->key[0];
+
+        for (int j = 0; j < z->n - 1; j++)
+            z->key[j] = z->key[j + 1];
+
+        for (int j = 0; j < z->n; j++)
+            z->c[j] = z->c[j + 1];
+    }
+
+    y->n++;
+    z->n--;
+
+    DISK_WRITE(x);
+    DISK_WRITE(y);
+    DISK_WRITE(z);
+}
+
+//Junta z, filho i + 1 de x, ao seu irmão à esquerda y. Em nós
+//internos a chave i de x desce; em folhas ela é descartada e y
+//herda o encadeamento de z. A página de z é liberada
+void BPlusTree::merge(BTreeNode* x, int i, BTreeNode* y, BTreeNode* z)
+{
+    if (y->leaf)
+    {
+        for (int j = 0; j < z->n; j++)
+            y->key[y->n + j] = z->key[j];
+
+        y->n += z->n;
+        y->next = z->next;
+    }
+    else
+    {
+        y->key[y->n] = x->key[i];
+
+        for (int j = 0; j < z->n; j++)
+            y->key[y->n + 1 + j] = z->key[j];
+
+        for (int j = 0; j <= z->n; j++)
+            y->c[y->n + 1 + j] = z->c[j];
+
+        y->n += z->n + 1;
+    }
+
+    for (int j = i; j < x->n - 1; j++)
+        x->key[j] = x->key[j + 1];
+
+    for (int j = i + 1; j < x->n; j++)
+        x->c[j] = x->c[j + 1];
+
+    x->n--;
+
+    freeNode(z);
+
+    DISK_WRITE(x);
+    DISK_WRITE(y);
+}
+
+//Imprime os nós e as chaves da árvore por nível
+void BPlusTree::levelTraversal()
+{
+    Queue* q = new Queue();
+    OutputBuffer out;
+
+    q->enqueue(root->id);
+
+    int remaining = 1; //nós restantes no nível atual
+    int next = 0;      //nós já enfileirados do próximo nível
+
+    while (!q->isEmpty())
+    {
+        BTreeNode* ptr = DISK_READ(q->dequeue());
+
+        out.write('|');
+
+        for (int i = 0; i < ptr->n; i++)
+        {
+            out.write(ptr->key[i]);
+            out.write(' ');
+        }
+
+        out.write('|');
+
+        if (!ptr->leaf)
+        {
+            for (int i = 0; i <= ptr->n; i++)
+                q->enqueue(ptr->c[i]);
+
+            next += ptr->n + 1;
+        }
+
+        release(ptr);
+
+        if (--remaining == 0 && !q->isEmpty())
+        {
+            out.write('\n');
+
+            remaining = next;
+            next = 0;
+        }
+    }
+
+    delete q;
+}
+
+//Posiciona o percurso na primeira chave maior ou igual a lo
+RangeScan::RangeScan(BPlusTree* tree, int lo, int hi)
+{
+    this->tree = tree;
+    this->hi = hi;
+
+    leaf = tree->findLeaf(lo);
+
+    i = keySearch(leaf->key, leaf->n, lo);
+}
+
+//Libera a folha corrente, se o percurso não terminou
+RangeScan::~RangeScan()
+{
+    tree->release(leaf);
+}
+
+//Coloca em key a próxima chave do intervalo. Retorna false quando
+//não houver mais chaves
+bool RangeScan::next(int& key)
+{
+    //Avança pelas folhas encadeadas, pulando as vazias
+    while (leaf != 0 && i >= leaf->n)
+    {
+        int next = leaf->next;
+
+        tree->release(leaf);
+
+        if (next != 0)
+            leaf = tree->DISK_READ(next);
+        else
+            leaf = 0;
+
+        i = 0;
+    }
+
+    if (leaf == 0 || leaf->key[i] > hi)
+    {
+        tree->release(leaf);
+        leaf = 0;
+
+        return false;
+    }
+
+    key = leaf->key[i++];
+
+    return true;
+}
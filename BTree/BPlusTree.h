@@ -0,0 +1,81 @@
+#ifndef BPLUSTREE_H
+#define BPLUSTREE_H
+
+#include "BufferPool.h"
+#include "KeySearch.h"
+
+//Definição da classe que representa uma B+-árvore. Todas as chaves
+//ficam nas folhas, que são encadeadas da esquerda para a direita;
+//os nós internos guardam apenas chaves de roteamento. Cada chave
+//de roteamento é menor ou igual a todas as chaves à sua direita.
+//Usa o mesmo arquivo de páginas e buffer pool da BTree.
+
+class BPlusTree;
+
+//Definição de um percurso, em ordem crescente, das chaves de um
+//intervalo. Mantém fixada apenas a folha corrente; a árvore não
+//deve ser alterada enquanto o percurso estiver aberto.
+class RangeScan
+{
+    private:
+        BPlusTree* tree;
+        BTreeNode* leaf; //folha corrente (0 ao terminar)
+        int i;           //posição da próxima chave na folha
+        int hi;
+
+    public:
+        RangeScan(BPlusTree*, int, int);
+        ~RangeScan();
+
+        bool next(int&);
+};
+
+class BPlusTree
+{
+    friend class RangeScan;
+
+    private:
+        int t; //ordem da b+-árvore
+        int numberOfKeys;
+        BTreeNode* root;
+        PageFile* file;
+        BufferPool* pool;
+
+        void open(int, int);
+        int childIndex(BTreeNode*, int);
+        BTreeNode* findLeaf(int);
+        void doInsert(int);
+        BTreeNode* splitChild(BTreeNode*, int, BTreeNode*);
+        void insertNonFull(BTreeNode*, int);
+        bool doRemove(BTreeNode*, int);
+        BTreeNode* fill(BTreeNode*, int, BTreeNode*);
+        void borrowLeft(BTreeNode*, int, BTreeNode*, BTreeNode*);
+        void borrowRight(BTreeNode*, int, BTreeNode*, BTreeNode*);
+        void merge(BTreeNode*, int, BTreeNode*, BTreeNode*);
+        void setRoot(BTreeNode*);
+        BTreeNode* allocateNode();
+        void freeNode(BTreeNode*);
+        void release(BTreeNode*);
+        BTreeNode* DISK_READ(int);
+        void DISK_WRITE(BTreeNode*);
+
+    public:
+        BPlusTree(int);
+        BPlusTree(int, int);
+        BPlusTree(int, const char*);
+        BPlusTree(int, const char*, int);
+        ~BPlusTree();
+
+        void flush();
+        BufferPool* getBufferPool();
+
+        bool search(int);
+        bool insert(int);
+        bool remove(int);
+        RangeScan* scan(int, int);
+
+        int size();
+        void levelTraversal();
+};
+
+#endif
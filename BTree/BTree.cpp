@@ -0,0 +1,1293 @@
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include "BTree.h"
+#include "../OutputBuffer.h"
+
+//Constrói uma B-árvore contendo apenas a raiz vazia, guardada
+//em um arquivo temporário.
+BTree::BTree(int order)
+{
+    file = new PageFile();
+    file->openTemporary(BTreeNode::pageSize(order));
+    log = 0;
+
+    open(order, DEFAULT_POOL_SIZE);
+}
+
+//Constrói uma B-árvore em um arquivo temporário, sem log, com um
+//buffer pool de poolSize nós. Usada pelos benchmarks que medem a
+//árvore em memória, sem o custo de forçar o log
+BTree::BTree(int order, int poolSize)
+{
+    file = new PageFile();
+    file->openTemporary(BTreeNode::pageSize(order));
+    log = 0;
+
+    open(order, poolSize);
+}
+
+//Constrói uma B-árvore persistente no arquivo fileName. Se o
+//arquivo já contém uma B-árvore, ela é reaberta com a ordem
+//gravada no arquivo.
+BTree::BTree(int order, const char* fileName)
+{
+    file = new PageFile();
+    file->open(fileName, BTreeNode::pageSize(order));
+    openLog(fileName);
+
+    open(order, DEFAULT_POOL_SIZE);
+}
+
+//Constrói uma B-árvore persistente no arquivo fileName, com um
+//buffer pool de poolSize nós
+BTree::BTree(int order, const char* fileName, int poolSize)
+{
+    file = new PageFile();
+    file->open(fileName, BTreeNode::pageSize(order));
+    openLog(fileName);
+
+    open(order, poolSize);
+}
+
+//Abre o log fileName.wal e refaz as operações que ainda não
+//estavam no arquivo de páginas
+void BTree::openLog(const char* fileName)
+{
+    char* logName = new char[strlen(fileName) + 5];
+
+    strcpy(logName, fileName);
+    strcat(logName, ".wal");
+
+    log = new WriteAheadLog();
+
+    if (log->open(logName, file->getPageSize()))
+    {
+        log->recover(file);
+        file->setLog(log);
+    }
+    else
+    {
+        delete log;
+        log = 0;
+    }
+
+    delete[] logName;
+}
+
+//Cria o buffer pool e carrega a raiz do arquivo ou, se o arquivo
+//é novo, cria uma raiz vazia. A raiz fica fixada enquanto for raiz
+void BTree::open(int order, int poolSize)
+{
+    root = 0;
+
+    writeSet = 0;
+    writeSetSize = writeSetCapacity = 0;
+    freedPages = 0;
+    freedSize = freedCapacity = 0;
+    page = new int[file->getPageSize() / sizeof(int)];
+
+    if (file->rootPage != 0)
+    {
+        t = file->order;
+        numberOfKeys = file->numberOfKeys;
+
+        pool = new BufferPool(file, t, poolSize);
+        root = DISK_READ(file->rootPage);
+    }
+    else
+    {
+        t = order;
+        numberOfKeys = 0;
+        file->order = t;
+
+        pool = new BufferPool(file, t, poolSize);
+
+        BTreeNode* node = allocateNode();
+
+        setRoot(node);
+        DISK_WRITE(node);
+        release(node);
+
+        commit();
+    }
+}
+
+//Destrói a B-árvore, gravando os nós sujos e o cabeçalho do arquivo
+BTree::~BTree()
+{
+    file->numberOfKeys = numberOfKeys;
+
+    //O buffer pool grava e sincroniza as páginas; depois disso o
+    //log não é mais necessário
+    delete pool;
+
+    if (log != 0)
+        log->truncate();
+
+    delete file;
+    delete log;
+
+    delete[] writeSet;
+    delete[] freedPages;
+    delete[] page;
+}
+
+//Grava no arquivo todos os nós alterados que estão no buffer pool
+//e esvazia o log (checkpoint)
+void BTree::flush()
+{
+    file->numberOfKeys = numberOfKeys;
+
+    pool->flush();
+
+    if (log != 0)
+        log->truncate();
+}
+
+//Torna duráveis as operações que aguardam o commit em grupo
+void BTree::sync()
+{
+    if (log != 0)
+        log->force();
+}
+
+//Define quantas operações são agrupadas em cada sincronização do log
+void BTree::setGroupCommit(int size)
+{
+    if (log != 0)
+        log->setGroupSize(size);
+}
+
+BufferPool* BTree::getBufferPool()
+{
+    return pool;
+}
+
+WriteAheadLog* BTree::getLog()
+{
+    return log;
+}
+
+//Inclui o nó no conjunto de nós alterados pela operação corrente.
+//Ele fica fixado até o commit, para que o buffer pool não grave no
+//arquivo uma alteração que ainda não está no log
+void BTree::remember(BTreeNode* node)
+{
+    for (int i = 0; i < writeSetSize; i++)
+        if (writeSet[i] == node)
+            return;
+
+    if (writeSetSize == writeSetCapacity)
+    {
+        writeSetCapacity = writeSetCapacity == 0 ? 16 : 2 * writeSetCapacity;
+
+        BTreeNode** bigger = new BTreeNode*[writeSetCapacity];
+
+        for (int i = 0; i < writeSetSize; i++)
+            bigger[i] = writeSet[i];
+
+        delete[] writeSet;
+        writeSet = bigger;
+    }
+
+    pool->pin(node);
+    writeSet[writeSetSize++] = node;
+}
+
+//Retira do conjunto de nós alterados um nó que será liberado
+void BTree::forget(BTreeNode* node)
+{
+    for (int i = 0; i < writeSetSize; i++)
+    {
+        if (writeSet[i] == node)
+        {
+            writeSet[i] = writeSet[--writeSetSize];
+            return;
+        }
+    }
+}
+
+//Termina a operação corrente: registra no log a imagem dos nós
+//alterados, o encadeamento das páginas liberadas e o estado do
+//cabeçalho. Só depois do commit as páginas liberadas voltam para a
+//lista livre do arquivo, já que a árvore anterior ainda as usa
+void BTree::commit()
+{
+    if (log == 0 || (writeSetSize == 0 && freedSize == 0))
+        return;
+
+    for (int i = 0; i < writeSetSize; i++)
+    {
+        writeSet[i]->toPage(page, t);
+        pool->markLogged(writeSet[i], log->appendPage(writeSet[i]->id, page));
+
+        pool->unpin(writeSet[i]);
+    }
+
+    file->numberOfKeys = numberOfKeys;
+
+    int state[PAGE_FILE_STATE];
+    file->getState(state);
+
+    for (int i = 0; i < freedSize; i++)
+    {
+        memset(page, 0, file->getPageSize());
+
+        page[0] = state[3];
+        log->appendPage(freedPages[i], page);
+
+        state[3] = freedPages[i];
+    }
+
+    log->commit(state);
+
+    for (int i = 0; i < freedSize; i++)
+        file->freePage(freedPages[i]);
+
+    writeSetSize = 0;
+    freedSize = 0;
+}
+
+//Inicia a busca por uma chave (value) na B-árvore
+bool BTree::search(int value)
+{
+    int i;
+    if (doSearch(root, value, i) != 0)
+        return true;
+
+    return false;
+}
+
+//Efetivamente busca, recursivamente, uma chave na B-árvore
+//Retorna a página do nó encontrado (0 se não encontrar) e
+//a posição da chave no vetor de chaves no parâmetro por
+//referência i
+int BTree::doSearch(BTreeNode* node, int value, int& i)
+{
+    i = keySearch(node->key, node->n, value);
+
+    if (i < node->n && value == node->key[i])
+        return node->id;
+    else
+    {
+        if (node->leaf == true)
+            return 0;
+
+        BTreeNode* child = DISK_READ(node->c[i]);
+
+        int found = doSearch(child, value, i);
+
+        release(child);
+
+        return found;
+    }
+}
+
+//Obtém, fixado no buffer pool, o nó guardado na página id. O
+//disco só é lido se o nó não estiver no buffer pool. O nó deve
+//ser devolvido com release quando não for mais usado.
+BTreeNode* BTree::DISK_READ(int id)
+{
+    return pool->fetch(id);
+}
+
+//Marca o nó como alterado; a gravação no disco acontece quando
+//ele for despejado do buffer pool ou em flush
+void BTree::DISK_WRITE(BTreeNode* node)
+{
+    pool->markDirty(node);
+
+    if (log != 0)
+        remember(node);
+}
+
+//Desfaz a fixação de um nó obtido com DISK_READ ou allocateNode
+void BTree::release(BTreeNode* node)
+{
+    if (node != 0)
+        pool->unpin(node);
+}
+
+//Cria, fixado, um nó vazio em uma nova página
+BTreeNode* BTree::allocateNode()
+{
+    return pool->create(file->allocatePage());
+}
+
+//Devolve a página do nó ao arquivo e o retira do buffer pool.
+//Com log, a página só é devolvida no commit
+void BTree::freeNode(BTreeNode* node)
+{
+    int id = node->id;
+
+    pool->discard(node);
+
+    if (log == 0)
+    {
+        file->freePage(id);
+        return;
+    }
+
+    forget(node);
+
+    if (freedSize == freedCapacity)
+    {
+        freedCapacity = freedCapacity == 0 ? 4 : 2 * freedCapacity;
+
+        int* bigger = new int[freedCapacity];
+
+        for (int i = 0; i < freedSize; i++)
+            bigger[i] = freedPages[i];
+
+        delete[] freedPages;
+        freedPages = bigger;
+    }
+
+    freedPages[freedSize++] = id;
+}
+
+//Troca a raiz da árvore, registrando a nova página no cabeçalho.
+//A nova raiz fica fixada e a antiga é liberada
+void BTree::setRoot(BTreeNode* node)
+{
+    pool->pin(node);
+
+    if (root != 0)
+        pool->unpin(root);
+
+    root = node;
+    file->rootPage = node->id;
+}
+
+//Inicia o processo de inserção de uma nova chave (value).
+//Busca para saber se não existe na árvore e somente nesse
+//momento chama doInsert para efetivamente inserir.
+bool BTree::insert(int key)
+{
+    if (search(key) == true)
+        return false;
+
+    doInsert(key);
+    numberOfKeys++;
+
+    commit();
+
+    return true;
+}
+
+//Inicia o processo de inserção na raiz, verificando
+//inicialmente, se ela não precisa ser quebrada antes
+//de invocar insertNonFull. Pode fazer a árvore aumentar
+//em altura
+void BTree::doInsert(int value)
+{
+    if (root->n == 2 * t - 1)
+        splitRoot();
+
+    insertNonFull(root, value);
+}
+
+//Quebra a raiz cheia, criando uma nova raiz com a mediana
+void BTree::splitRoot()
+{
+    BTreeNode* s = allocateNode();
+    BTreeNode* y = root;
+
+    s->leaf = false;
+    s->n = 0;
+    s->c[0] = y->id;
+
+    BTreeNode* z = splitChild(s, 0, y);
+
+    setRoot(s);
+
+    release(z);
+    release(s);
+}
+
+//Quebra o nó cheio y, i-ésimo filho de x, em dois e sobe a
+//mediana para o pai. Retorna o novo irmão à direita de y, que
+//deve ser devolvido com release
+BTreeNode* BTree::splitChild(BTreeNode* x, int i, BTreeNode* y)
+{
+    BTreeNode* z = allocateNode();
+
+    z->leaf = y->leaf;
+    z->n = t - 1;
+
+    for (int j = 0; j < t - 1; j++)
+        z->key[j] = y->key[j + t];
+
+    if (!y->leaf)
+    {
+        for (int j = 0; j < t; j++)
+            z->c[j] = y->c[j + t];
+    }
+    y->n = t - 1;
+
+    for (int j = x->n; j > i; j--)
+        x->c[j + 1] = x->c[j];
+
+    x->c[i + 1] = z->id;
+
+    for (int j = x->n - 1; j >= i; j--)
+        x->key[j + 1] = x->key[j];
+
+    x->key[i] = y->key[t - 1];
+    x->n++;
+
+    DISK_WRITE(y);
+    DISK_WRITE(z);
+    DISK_WRITE(x);
+
+    return z;
+}
+
+//Recursivamente, insere uma nova chave em um nó não cheio
+void BTree::insertNonFull(BTreeNode* x, int value)
+{
+    int i = x->n - 1;
+
+    if (x->leaf)
+    {
+        //printf("\nFolha -> n = %d", x->n);
+        fflush(NULL);
+        int pos = keySearch(x->key, x->n, value);
+
+        for (; i >= pos; i--)
+            x->key[i + 1] = x->key[i];
+
+        x->key[pos] = value;
+        x->n++;
+
+        DISK_WRITE(x);
+    }
+    else
+    {
+        i = keySearch(x->key, x->n, value);
+
+        BTreeNode* child = DISK_READ(x->c[i]);
+
+        if (child->n == 2 * t - 1)
+        {
+            BTreeNode* z = splitChild(x, i, child);
+
+            if (value > x->key[i])
+            {
+                release(child);
+                child = z;
+            }
+            else
+                release(z);
+        }
+        insertNonFull(child, value);
+
+        release(child);
+    }
+}
+
+//Constrói, de baixo para cima, a árvore a partir de count chaves
+//estritamente crescentes. As folhas são preenchidas da esquerda
+//para a direita com cerca de fill * (2t - 1) chaves e cada nível
+//interno é montado com as chaves que separam os nós do nível de
+//baixo, em uma única passada linear. Só funciona com a árvore
+//vazia; retorna false se ela não estiver vazia ou se a entrada
+//não estiver ordenada.
+bool BTree::bulkLoad(const int* keys, int count, float fill)
+{
+    if (numberOfKeys != 0)
+        return false;
+
+    for (int i = 1; i < count; i++)
+        if (keys[i] <= keys[i - 1])
+            return false;
+
+    if (count == 0)
+        return true;
+
+    if (fill <= 0 || fill > 1)
+        fill = 1;
+
+    int target = (int) (fill * (2 * t - 1) + 0.5f);
+    if (target < t - 1)
+        target = t - 1;
+
+    const int* level = keys; //chaves do nível sendo construído
+    int m = count;
+    int* children = 0;       //páginas do nível de baixo
+
+    while (true)
+    {
+        //Quantidade de nós do nível: cada nó mais o separador à sua
+        //direita ocupa entre t e 2t chaves
+        int L = (m + 1 + target) / (target + 1);
+        int lo = (m + 2 * t) / (2 * t);
+        int hi = (m + 1) / t;
+
+        if (L > hi)
+            L = hi;
+        if (L < lo)
+            L = lo;
+        if (L < 1)
+            L = 1;
+
+        int* separators = new int[L - 1];
+        int* ids = new int[L];
+
+        int pos = 0;
+        int childPos = 0;
+
+        for (int j = 0; j < L; j++)
+        {
+            int size = (m + 1) / L + (j < (m + 1) % L ? 1 : 0) - 1;
+
+            BTreeNode* node = allocateNode();
+
+            node->leaf = (children == 0);
+            node->n = size;
+
+            for (int i = 0; i < size; i++)
+                node->key[i] = level[pos + i];
+
+            if (!node->leaf)
+            {
+                for (int i = 0; i <= size; i++)
+                    node->c[i] = children[childPos + i];
+
+                childPos += size + 1;
+            }
+
+            pos += size;
+
+            if (j < L - 1)
+                separators[j] = level[pos++];
+
+            ids[j] = node->id;
+
+            DISK_WRITE(node);
+            release(node);
+
+            commit();
+        }
+
+        if (level != keys)
+            delete[] level;
+
+        delete[] children;
+
+        if (L == 1)
+        {
+            BTreeNode* old = root;
+            BTreeNode* top = DISK_READ(ids[0]);
+
+            setRoot(top);
+            release(top);
+
+            freeNode(old);
+
+            delete[] separators;
+            delete[] ids;
+
+            break;
+        }
+
+        level = separators;
+        m = L - 1;
+        children = ids;
+    }
+
+    numberOfKeys = count;
+
+    commit();
+
+    return true;
+}
+
+//Ordena posições de um lote pela chave correspondente
+struct BatchOrder
+{
+    const int* keys;
+
+    bool operator()(int a, int b) const
+    {
+        return keys[a] < keys[b];
+    }
+};
+
+//Primeira posição em [lo, hi) do vetor ordenado keys com chave
+//maior ou igual a value (hi se não houver)
+static int lowerBound(const int* keys, int lo, int hi, int value)
+{
+    while (lo < hi)
+    {
+        int mid = lo + (hi - lo) / 2;
+
+        if (keys[mid] < value)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    return lo;
+}
+
+//Busca count chaves de uma vez, indicando em found se cada uma
+//está na árvore. Retorna quantas foram encontradas. O lote é
+//ordenado e a árvore, percorrida uma única vez: chaves vizinhas
+//compartilham o caminho desde a raiz e cada nó é lido uma vez
+//para todas as chaves que passam por ele
+int BTree::searchBatch(const int* keys, int count, bool* found)
+{
+    int* order = new int[count];
+    int* sorted = new int[count];
+    bool* sortedFound = new bool[count];
+
+    for (int j = 0; j < count; j++)
+        order[j] = j;
+
+    BatchOrder byKey;
+    byKey.keys = keys;
+    std::sort(order, order + count, byKey);
+
+    for (int j = 0; j < count; j++)
+        sorted[j] = keys[order[j]];
+
+    doSearchBatch(root, sorted, 0, count, sortedFound);
+
+    int hits = 0;
+
+    for (int j = 0; j < count; j++)
+    {
+        found[order[j]] = sortedFound[j];
+
+        if (sortedFound[j])
+            hits++;
+    }
+
+    delete[] order;
+    delete[] sorted;
+    delete[] sortedFound;
+
+    return hits;
+}
+
+//Busca no nó as chaves ordenadas keys[lo, hi). As chaves que não
+//estão no nó são divididas em trechos, um por filho; enquanto um
+//trecho é resolvido, o filho do trecho seguinte é antecipado
+void BTree::doSearchBatch(BTreeNode* node, const int* keys, int lo, int hi, bool* found)
+{
+    int pos = lo;
+
+    while (pos < hi)
+    {
+        int i = keySearch(node->key, node->n, keys[pos]);
+
+        if (i < node->n && node->key[i] == keys[pos])
+        {
+            found[pos++] = true;
+            continue;
+        }
+
+        //Fim do trecho que desce para o filho i
+        int end = i < node->n ? lowerBound(keys, pos, hi, node->key[i]) : hi;
+
+        if (node->leaf)
+        {
+            for (; pos < end; pos++)
+                found[pos] = false;
+
+            continue;
+        }
+
+        if (end < hi)
+            pool->prefetch(node->c[keySearch(node->key, node->n, keys[end])]);
+
+        BTreeNode* child = DISK_READ(node->c[i]);
+
+        doSearchBatch(child, keys, pos, end, found);
+
+        release(child);
+
+        pos = end;
+    }
+}
+
+//Insere count chaves de uma vez, ignorando as repetidas e as que
+//já estão na árvore. Retorna quantas foram inseridas. O lote é
+//ordenado e filtrado com uma busca em lote; depois cada folha
+//recebe de uma só vez todas as chaves do seu trecho que couberem
+int BTree::insertBatch(const int* keys, int count)
+{
+    int* sorted = new int[count];
+    int m = 0;
+
+    for (int j = 0; j < count; j++)
+        sorted[j] = keys[j];
+
+    std::sort(sorted, sorted + count);
+
+    for (int j = 0; j < count; j++)
+        if (m == 0 || sorted[j] != sorted[m - 1])
+            sorted[m++] = sorted[j];
+
+    bool* found = new bool[m];
+
+    doSearchBatch(root, sorted, 0, m, found);
+
+    int k = 0;
+
+    for (int j = 0; j < m; j++)
+        if (!found[j])
+            sorted[k++] = sorted[j];
+
+    //Cada chamada para quando a raiz enche e precisa ser quebrada
+    int pos = 0;
+
+    while (pos < k)
+    {
+        if (root->n == 2 * t - 1)
+            splitRoot();
+
+        pos = insertRun(root, sorted, pos, k);
+    }
+
+    commit();
+
+    delete[] sorted;
+    delete[] found;
+
+    return k;
+}
+
+//Insere no nó x, que não está cheio, as chaves keys[lo, hi), que
+//não estão na árvore. Como em insertNonFull, os filhos cheios são
+//quebrados antes da descida; se x encher e ainda houver um filho
+//cheio no caminho, para e deixa o pai quebrar x. Retorna a posição
+//da primeira chave não inserida
+int BTree::insertRun(BTreeNode* x, const int* keys, int lo, int hi)
+{
+    if (x->leaf)
+    {
+        int m = 2 * t - 1 - x->n;
+
+        if (m > hi - lo)
+            m = hi - lo;
+
+        //Intercala, de trás para frente, as m menores chaves do trecho
+        int a = x->n - 1;
+        int b = lo + m - 1;
+        int k = x->n + m - 1;
+
+        while (b >= lo)
+        {
+            if (a >= 0 && x->key[a] > keys[b])
+                x->key[k--] = x->key[a--];
+            else
+                x->key[k--] = keys[b--];
+        }
+
+        x->n += m;
+        numberOfKeys += m;
+
+        DISK_WRITE(x);
+
+        //A árvore está consistente após cada folha
+        commit();
+
+        return lo + m;
+    }
+
+    int pos = lo;
+
+    while (pos < hi)
+    {
+        int i = keySearch(x->key, x->n, keys[pos]);
+        int end = i < x->n ? lowerBound(keys, pos, hi, x->key[i]) : hi;
+
+        BTreeNode* child = DISK_READ(x->c[i]);
+
+        if (child->n == 2 * t - 1)
+        {
+            if (x->n == 2 * t - 1)
+            {
+                release(child);
+                break;
+            }
+
+            BTreeNode* z = splitChild(x, i, child);
+
+            release(z);
+            release(child);
+
+            continue;
+        }
+
+        if (end < hi)
+            pool->prefetch(x->c[keySearch(x->key, x->n, keys[end])]);
+
+        pos = insertRun(child, keys, pos, end);
+
+        release(child);
+    }
+
+    return pos;
+}
+
+//Inicia o processo de remoção através de uma chamada
+//inicial à busca. Caso encontre, chama o método que vai
+//realizar a remoção
+bool BTree::remove(int x)
+{
+    BTreeNode* pt = root;
+
+    if (!pt)
+        return false;
+
+    //Mesmo sem encontrar a chave a descida pode ter rebalanceado nós
+    bool ret = doRemove(root, x);
+
+    if (ret)
+        numberOfKeys--;
+
+    commit();
+
+    return ret;
+}
+
+//Recursivamente, realiza a remoção da chave da árvore.
+//Somente desce para a subárvore para continuar a busca
+//caso a raiz da subárvore tenha pelo menos t chaves. A
+//remoção também será realizada somente se a folha tiver
+//pelo menos t elementos.
+bool BTree::doRemove(BTreeNode* pt, int x)
+{
+    BTreeNode* u = 0;
+    BTreeNode* w;
+    BTreeNode* y;
+    BTreeNode* z = 0;
+    bool ret;
+
+    int i = keySearch(pt->key, pt->n, x);
+
+    if (i < pt->n && x == pt->key[i])
+    {
+        if (pt->leaf)
+        {
+            //Caso 1
+            for (int j = i; j < pt->n - 1; j++)
+                pt->key[j] = pt->key[j + 1];
+
+            pt->n--;
+
+            DISK_WRITE(pt);
+
+            return true;
+        }
+        else
+        {
+            //Caso 2
+            y = DISK_READ(pt->c[i]);
+
+            if (y->n > t - 1)
+            {
+                //Caso 2a
+                u = y;
+
+                while (!u->leaf)
+                {
+                    w = DISK_READ(u->c[u->n]);
+
+                    if (u != y)
+                        release(u);
+
+                    u = w;
+                }
+
+                int predecessor = u->key[u->n - 1];
+
+                if (u != y)
+                    release(u);
+
+                pt->key[i] = predecessor;
+                DISK_WRITE(pt);
+
+                ret = doRemove(y, predecessor);
+                release(y);
+
+                return ret;
+            }
+            else
+            {
+                z = DISK_READ(pt->c[i + 1]);
+
+                if (z->n > t - 1)
+                {
+                    //Caso 2b
+                    u = z;
+
+                    while (!u->leaf)
+                    {
+                        w = DISK_READ(u->c[0]);
+
+                        if (u != z)
+                            release(u);
+
+                        u = w;
+                    }
+
+                    int successor = u->key[0];
+
+                    if (u != z)
+                        release(u);
+
+                    pt->key[i] = successor;
+
+                    DISK_WRITE(pt);
+
+                    release(y);
+
+                    ret = doRemove(z, successor);
+                    release(z);
+
+                    return ret;
+                }
+                else
+                {
+                    //Caso 2c
+                    merge(pt, i, y, z);
+
+                    if (pt == root && pt->n == 0)
+                    {
+                        setRoot(y);
+
+                        freeNode(pt);
+                    }
+
+                    ret = doRemove(y, x);
+                    release(y);
+
+                    return ret;
+                }
+            }
+        }
+    }
+    else
+    {
+        if (pt->leaf)
+            return false;
+
+        y = DISK_READ(pt->c[i]);
+
+        if (y->n > t - 1)
+        {
+            ret = doRemove(y, x);
+            release(y);
+
+            return ret;
+        }
+        else
+        {
+            //Caso 3
+            if (i > 0)
+                u = DISK_READ(pt->c[i - 1]);
+
+            if (i < pt->n)
+                z = DISK_READ(pt->c[i + 1]);
+
+            if (i > 0 && u->n > t - 1)
+            {
+                //Caso 3a - esquerda
+                y->c[t] = y->c[t - 1];
+
+                for (int j = t - 2; j >= 0; j--)
+                {
+                    y->key[j + 1] = y->key[j];
+                    y->c[j + 1] = y->c[j];
+                }
+
+                y->key[0] = pt->key[i - 1];
+                y->c[0] = u->c[u->n];
+                y->n++;
+
+                pt->key[i - 1] = u->key[u->n - 1];
+                u->n--;
+
+                DISK_WRITE(pt);
+                DISK_WRITE(u);
+                DISK_WRITE(y);
+
+                release(u);
+                release(z);
+
+                ret = doRemove(y, x);
+                release(y);
+
+                return ret;
+            }
+            else
+	        {
+                if (i < pt->n && z->n > t - 1)
+                {
+                    //Caso 3a - direita
+                    y->n++;
+                    y->key[t - 1] = pt->key[i];
+                    y->c[t] = z->c[0];
+
+                    pt->key[i] = z->key[0];
+
+                    for (int j = 0; j < z->n - 1; j++)
+                    {
+                        z->key[j] = z->key[j + 1];
+                        z->c[j] = z->c[j + 1];
+                    }
+
+                    z->c[z->n - 1] = z->c[z->n];
+                    z->n--;
+
+                    DISK_WRITE(pt);
+                    DISK_WRITE(z);
+                    DISK_WRITE(y);
+
+                    release(u);
+                    release(z);
+
+                    ret = doRemove(y, x);
+                    release(y);
+
+                    return ret;
+                }
+                else
+                {
+                    //Caso 3b
+                    if (i < pt->n)
+                    {
+                        merge(pt, i, y, z);
+                        release(u);
+
+                        w = y;
+                    }
+                    else
+                    {
+                        merge(pt, i - 1, u, y);
+
+                        w = u;
+                    }
+
+                    if (pt == root && pt->n == 0)
+                    {
+                        setRoot(w);
+
+                        freeNode(pt);
+                    }
+
+                    ret = doRemove(w, x);
+                    release(w);
+
+                    return ret;
+                }
+	        }
+        }
+    }
+}
+
+//Junta z, filho i + 1 de pt, ao seu irmão à esquerda y, descendo
+//a chave i de pt. A página de z é liberada
+void BTree::merge(BTreeNode* pt, int i, BTreeNode* y, BTreeNode* z)
+{
+    y->key[t - 1] = pt->key[i];
+
+    for (int j = t; j < 2 * t - 1; j++)
+    {
+        y->c[j] = z->c[j - t];
+        y->key[j] = z->key[j - t];
+    }
+
+    y->c[2 * t - 1] = z->c[t - 1];
+    y->n = 2 * t - 1;
+
+    for (int j = i; j < pt->n - 1; j++)
+        pt->key[j] = pt->key[j + 1];
+
+    for (int j = i + 1; j < pt->n; j++)
+        pt->c[j] = pt->c[j + 1];
+
+    pt->n--;
+
+    freeNode(z);
+
+    DISK_WRITE(pt);
+    DISK_WRITE(y);
+}
+
+//Imprime a árvore em pré-ordem, um nó por linha, com a mesma pilha
+//de nós abertos de visitInOrder; a saída passa por um OutputBuffer
+void BTree::print()
+{
+    OutputBuffer out;
+    BTreeNode* path[BTREE_MAX_HEIGHT];
+    int next[BTREE_MAX_HEIGHT];
+    int top = 1;
+
+    if (root == 0)
+        return;
+
+    printNode(out, root, 0, 0);
+    path[0] = root;
+    next[0] = 0;
+
+    while (top > 0)
+    {
+        BTreeNode* node = path[top - 1];
+
+        if (node->leaf || next[top - 1] > node->n)
+        {
+            if (top > 1)
+                release(node);
+
+            top--;
+            continue;
+        }
+
+        BTreeNode* child = DISK_READ(node->c[next[top - 1]++]);
+
+        printNode(out, child, node, 5 * top);
+        path[top] = child;
+        next[top] = 0;
+        top++;
+    }
+}
+
+void BTree::printNode(OutputBuffer& out, BTreeNode* node, BTreeNode* parent, int spaces)
+{
+    out.spaces(spaces);
+
+    for (int i = 0; i < node->n; i++)
+    {
+        out.write(node->key[i]);
+        out.write(' ');
+    }
+
+    out.write('(');
+    out.write((int) node->leaf);
+    out.write(") (");
+    out.write(node->n);
+    out.write(") (");
+
+    if (parent)
+        out.write(parent->key[0]);
+    else
+        out.write("nulo");
+
+    out.write(")\n");
+}
+
+//Imprime os nós e as chaves da árvore por nível
+void BTree::levelTraversal()
+{
+    Queue* q = new Queue();
+    OutputBuffer out;
+
+    q->enqueue(root->id);
+
+    int remaining = 1; //nós restantes no nível atual
+    int next = 0;      //nós já enfileirados do próximo nível
+
+    //Enquanto houver alguém na fila
+    while (!q->isEmpty())
+    {
+        BTreeNode* ptr = DISK_READ(q->dequeue());
+
+        out.write('|');
+
+        for (int i = 0; i < ptr->n; i++)
+        {
+            out.write(ptr->key[i]);
+            out.write(' ');
+        }
+
+        out.write('|');
+
+        if (!ptr->leaf)
+        {
+            for (int i = 0; i <= ptr->n; i++)
+                q->enqueue(ptr->c[i]);
+
+            next += ptr->n + 1;
+        }
+
+        release(ptr);
+
+        if (--remaining == 0 && !q->isEmpty())
+        {
+            out.write('\n');
+
+            remaining = next;
+            next = 0;
+        }
+    }
+
+    delete q;
+}
+
+//Grava em fileName uma fotografia somente de leitura da árvore,
+//com os nós na mesma ordem de levelTraversal, para ser aberta
+//com BTreeSnapshot
+bool BTree::freeze(const char* fileName)
+{
+    FILE* out = fopen(fileName, "wb");
+
+    if (out == 0)
+    {
+        printf("Erro ao abrir o arquivo %s\n", fileName);
+        return false;
+    }
+
+    //Cabeçalho; a quantidade de nós é regravada no final
+    int header[SNAPSHOT_HEADER] = { SNAPSHOT_MAGIC, t, 0, numberOfKeys };
+    fwrite(header, sizeof(int), SNAPSHOT_HEADER, out);
+
+    int recordSize = 2 * t + 1;
+    int* record = new int[recordSize];
+
+    Queue* q = new Queue();
+
+    q->enqueue(root->id);
+
+    int numberOfNodes = 0;
+    int nextChild = 1; //índice, na ordem de nível, do próximo filho
+
+    while (!q->isEmpty())
+    {
+        BTreeNode* ptr = DISK_READ(q->dequeue());
+
+        record[0] = ptr->n;
+        record[1] = -1;
+
+        for (int i = 0; i < 2 * t - 1; i++)
+            record[2 + i] = i < ptr->n ? ptr->key[i] : 0;
+
+        if (!ptr->leaf)
+        {
+            record[1] = nextChild;
+            nextChild += ptr->n + 1;
+
+            for (int i = 0; i <= ptr->n; i++)
+                q->enqueue(ptr->c[i]);
+        }
+
+        release(ptr);
+
+        fwrite(record, sizeof(int), recordSize, out);
+        numberOfNodes++;
+    }
+
+    header[2] = numberOfNodes;
+    fseek(out, 0, SEEK_SET);
+    fwrite(header, sizeof(int), SNAPSHOT_HEADER, out);
+
+    delete q;
+    delete[] record;
+
+    return fclose(out) == 0;
+}
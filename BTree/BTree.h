@@ -0,0 +1,131 @@
+#include "BufferPool.h"
+#include "BTreeSnapshot.h"
+#include "KeySearch.h"
+#include "WriteAheadLog.h"
+#include "Queue.h"
+
+class OutputBuffer;
+
+//Altura máxima da árvore (t >= 2 e até 2^31 chaves), usada pelas
+//pilhas dos percursos
+#define BTREE_MAX_HEIGHT 32
+
+//Definição da classe que representa uma B-árvore.
+//Os nós ficam em um arquivo de páginas e são acessados por meio
+//de um buffer pool; a raiz permanece sempre fixada em memória.
+//Uma árvore persistente mantém um log de refazer ao lado do
+//arquivo (fileName.wal): cada operação termina com commit, que
+//registra no log as páginas alteradas, e na abertura as operações
+//registradas são refeitas.
+
+class BTree
+{
+    private:
+        int t; //ordem da b-árvore
+        int numberOfKeys;   // quantidade de chaves
+        BTreeNode* root;
+        PageFile* file;
+        BufferPool* pool;
+        WriteAheadLog* log;
+
+        BTreeNode** writeSet; //nós alterados pela operação corrente
+        int writeSetSize;
+        int writeSetCapacity;
+        int* freedPages;      //páginas liberadas pela operação corrente
+        int freedSize;
+        int freedCapacity;
+        int* page;            //buffer de uma página para o log
+
+        void open(int, int);
+        void openLog(const char*);
+        void remember(BTreeNode*);
+        void forget(BTreeNode*);
+        void commit();
+        int doSearch(BTreeNode*, int, int&);
+        void doInsert(int);
+        void splitRoot();
+        void doSearchBatch(BTreeNode*, const int*, int, int, bool*);
+        int insertRun(BTreeNode*, const int*, int, int);
+        BTreeNode* splitChild(BTreeNode*, int, BTreeNode*);
+        void insertNonFull(BTreeNode*, int);
+        bool doRemove(BTreeNode*, int);
+        void printNode(OutputBuffer&, BTreeNode*, BTreeNode*, int);
+        void merge(BTreeNode*, int, BTreeNode*, BTreeNode*);
+        void setRoot(BTreeNode*);
+        BTreeNode* allocateNode();
+        void freeNode(BTreeNode*);
+        void release(BTreeNode*);
+        BTreeNode* DISK_READ(int);
+        void DISK_WRITE(BTreeNode*);
+
+    public:
+        BTree(int);
+        BTree(int, int);
+        BTree(int, const char*);
+        BTree(int, const char*, int);
+        ~BTree();
+
+        void flush();
+        void sync();
+        void setGroupCommit(int);
+        BufferPool* getBufferPool();
+        WriteAheadLog* getLog();
+
+        bool search(int);
+        bool insert(int);
+        bool remove(int);
+        int searchBatch(const int*, int, bool*);
+        int insertBatch(const int*, int);
+        bool bulkLoad(const int*, int, float);
+
+        void print();
+        void levelTraversal();
+
+        //Chama visit(chave) para cada chave, em ordem crescente, sem
+        //recursão: uma pilha guarda os nós abertos, fixados no buffer
+        //pool, e o passo de cada um (pares descem ao filho i / 2,
+        //ímpares visitam a chave i / 2)
+        template <class Visitor>
+        void visitInOrder(Visitor visit)
+        {
+            BTreeNode* path[BTREE_MAX_HEIGHT];
+            int step[BTREE_MAX_HEIGHT];
+            int top = 1;
+
+            path[0] = root;
+            step[0] = 0;
+
+            while (top > 0)
+            {
+                BTreeNode* node = path[top - 1];
+
+                if (node->leaf || step[top - 1] > 2 * node->n)
+                {
+                    if (node->leaf)
+                        for (int i = 0; i < node->n; i++)
+                            visit(node->key[i]);
+
+                    //A raiz fica sempre fixada
+                    if (top > 1)
+                        release(node);
+
+                    top--;
+                    continue;
+                }
+
+                int s = step[top - 1]++;
+
+                if (s % 2 == 1)
+                    visit(node->key[s / 2]);
+                else
+                {
+                    path[top] = DISK_READ(node->c[s / 2]);
+                    step[top] = 0;
+                    top++;
+                }
+            }
+        }
+
+        bool freeze(const char*);
+};
+
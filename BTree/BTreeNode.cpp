@@ -0,0 +1,124 @@
+#include <stdlib.h>
+#include <new>
+#include "BTreeNode.h"
+
+//Aloca o bloco de um nó de ordem t. Com BTREE_SPLIT_NODE o bloco
+//só tem os campos do nó; as chaves e os filhos são alocados à parte
+#ifdef BTREE_SPLIT_NODE
+void* BTreeNode::operator new(size_t size, int)
+{
+    return ::operator new(size);
+}
+#else
+void* BTreeNode::operator new(size_t, int t)
+{
+    void* block;
+
+    if (posix_memalign(&block, CACHE_LINE, blockSize(t)) != 0)
+        throw std::bad_alloc();
+
+    return block;
+}
+#endif
+
+//Libera o bloco de um nó
+void BTreeNode::operator delete(void* block)
+{
+#ifdef BTREE_SPLIT_NODE
+    ::operator delete(block);
+#else
+    free(block);
+#endif
+}
+
+//Libera o bloco se o construtor falhar
+void BTreeNode::operator delete(void* block, int)
+{
+    BTreeNode::operator delete(block);
+}
+
+//Constrói um nó da B-árvore
+BTreeNode::BTreeNode(int t)
+{
+    id = 0;
+    n = 0;
+    next = 0;
+    leaf = true;
+
+#ifdef BTREE_SPLIT_NODE
+    key = new int[2 * t - 1];
+    c = new int[2 * t];
+#else
+    key = (int*) (this + 1);
+    c = key + 2 * t - 1;
+#endif
+
+    for(int i = 0; i < (2 * t); i++)
+        c[i] = 0;
+}
+
+//Destrói um nó da B-árvore
+BTreeNode::~BTreeNode()
+{
+#ifdef BTREE_SPLIT_NODE
+  delete[] key;
+
+  delete[] c;
+#endif
+}
+
+//Tamanho, em bytes, do bloco em memória de um nó de ordem t,
+//arredondado para linhas de cache inteiras
+int BTreeNode::blockSize(int t)
+{
+    int size = sizeof(BTreeNode) + (4 * t - 1) * sizeof(int);
+
+    return (size + CACHE_LINE - 1) / CACHE_LINE * CACHE_LINE;
+}
+
+//Retorna a maior ordem cujo bloco em memória cabe em bytes, por
+//exemplo algumas linhas de cache ou uma página de 4096 bytes
+int BTreeNode::orderFor(int bytes)
+{
+    int t = 2;
+
+    while (blockSize(t + 1) <= bytes)
+        t++;
+
+    return t;
+}
+
+//Tamanho, em bytes, da página que guarda um nó de ordem t:
+//n, leaf, next, 2t - 1 chaves e 2t filhos
+int BTreeNode::pageSize(int t)
+{
+    return (3 + (2 * t - 1) + 2 * t) * sizeof(int);
+}
+
+//Serializa o nó na página
+void BTreeNode::toPage(int* page, int t)
+{
+    page[0] = n;
+    page[1] = leaf;
+    page[2] = next;
+
+    for (int i = 0; i < 2 * t - 1; i++)
+        page[3 + i] = key[i];
+
+    for (int i = 0; i < 2 * t; i++)
+        page[2 * t + 2 + i] = c[i];
+}
+
+//Reconstrói o nó a partir da página
+void BTreeNode::fromPage(const int* page, int t)
+{
+    n = page[0];
+    leaf = page[1] != 0;
+    next = page[2];
+
+    for (int i = 0; i < 2 * t - 1; i++)
+        key[i] = page[3 + i];
+
+    for (int i = 0; i < 2 * t; i++)
+        c[i] = page[2 * t + 2 + i];
+}
@@ -0,0 +1,42 @@
+#ifndef BTREENODE_H
+#define BTREENODE_H
+
+#include <stddef.h>
+
+#define CACHE_LINE 64
+
+//Definição da classe que representa um nó da B-árvore.
+//Os filhos e a próxima folha são identificados pelo número da
+//página em disco.
+//
+//O nó, suas 2t - 1 chaves e seus 2t filhos ocupam um único bloco
+//alinhado à linha de cache, com as chaves logo após os campos do
+//nó; por isso ele deve ser criado com new (t) BTreeNode(t).
+//Compilando com -DBTREE_SPLIT_NODE volta-se ao leiaute antigo, com
+//chaves e filhos em alocações separadas, para comparação.
+
+class BTreeNode
+{
+    public:
+        int id;          //página do nó no arquivo
+        int n;
+        int next;        //próxima folha, usada pela B+-árvore
+        bool leaf;
+        int* key;        
+        int* c;
+
+        BTreeNode(int);
+        ~BTreeNode();
+
+        static void* operator new(size_t, int);
+        static void operator delete(void*);
+        static void operator delete(void*, int);
+
+        static int blockSize(int);
+        static int orderFor(int);
+        static int pageSize(int);
+        void toPage(int*, int);
+        void fromPage(const int*, int);
+};
+
+#endif
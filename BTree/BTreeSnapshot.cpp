@@ -0,0 +1,131 @@
+#include <stdio.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "BTreeSnapshot.h"
+#include "KeySearch.h"
+
+//Constrói uma fotografia fechada
+BTreeSnapshot::BTreeSnapshot()
+{
+    data = 0;
+    length = 0;
+    nodes = 0;
+    t = 0;
+    numberOfNodes = 0;
+    numberOfKeys = 0;
+}
+
+//Desfaz o mapeamento do arquivo
+BTreeSnapshot::~BTreeSnapshot()
+{
+    close();
+}
+
+//Mapeia o arquivo fileName em memória. Retorna false se o
+//arquivo não existir ou não for uma fotografia válida
+bool BTreeSnapshot::open(const char* fileName)
+{
+    close();
+
+    int fd = ::open(fileName, O_RDONLY);
+
+    if (fd < 0)
+    {
+        printf("Erro ao abrir o arquivo %s\n", fileName);
+        return false;
+    }
+
+    struct stat st;
+
+    if (fstat(fd, &st) < 0 || st.st_size < (long) (SNAPSHOT_HEADER * sizeof(int)))
+    {
+        ::close(fd);
+        return false;
+    }
+
+    void* map = mmap(0, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+
+    //O mapeamento continua válido depois de fechar o descritor
+    ::close(fd);
+
+    if (map == MAP_FAILED)
+        return false;
+
+    const int* header = (const int*) map;
+
+    //O tamanho do arquivo tem de bater com o cabeçalho; senão a busca
+    //leria além do mapeamento
+    if (header[0] != SNAPSHOT_MAGIC || header[1] < 2 || header[2] < 0 || header[3] < 0 ||
+        st.st_size != (SNAPSHOT_HEADER + (long) header[2] * (2 * header[1] + 1)) * (long) sizeof(int))
+    {
+        munmap(map, st.st_size);
+        return false;
+    }
+
+    data = map;
+    length = st.st_size;
+    t = header[1];
+    numberOfNodes = header[2];
+    numberOfKeys = header[3];
+    nodes = header + SNAPSHOT_HEADER;
+
+    return true;
+}
+
+//Desfaz o mapeamento do arquivo
+void BTreeSnapshot::close()
+{
+    if (data == 0)
+        return;
+
+    munmap(data, length);
+
+    data = 0;
+    nodes = 0;
+}
+
+//Busca iterativamente uma chave, descendo da raiz (nó 0). Um nó com
+//mais de 2t - 1 chaves ou um filho fora do arquivo (ou que não esteja
+//depois do pai, na ordem de nível) encerra a busca, sem ler além do
+//mapeamento
+bool BTreeSnapshot::search(int value)
+{
+    if (numberOfNodes == 0)
+        return false;
+
+    int recordSize = 2 * t + 1;
+    long index = 0;
+
+    while (true)
+    {
+        const int* node = nodes + index * recordSize;
+        int n = node[0];
+        const int* key = node + 2;
+
+        if (n < 0 || n > 2 * t - 1)
+            return false;
+
+        int i = keySearch(key, n, value);
+
+        if (i < n && value == key[i])
+            return true;
+
+        if (node[1] < 0)
+            return false;
+
+        long child = (long) node[1] + i;
+
+        if (child <= index || child >= numberOfNodes)
+            return false;
+
+        index = child;
+    }
+}
+
+//Retorna a quantidade de chaves da fotografia
+int BTreeSnapshot::size()
+{
+    return numberOfKeys;
+}
@@ -0,0 +1,39 @@
+#ifndef BTREESNAPSHOT_H
+#define BTREESNAPSHOT_H
+
+//Definição da classe que representa uma fotografia somente de
+//leitura de uma B-árvore, gerada por BTree::freeze. O arquivo é
+//mapeado em memória e pesquisado diretamente, sem desserializar
+//nem alocar nós. Vários processos compartilham as mesmas páginas.
+//
+//Formato do arquivo (inteiros):
+//  cabeçalho: magic, t, quantidade de nós, quantidade de chaves
+//  nós em ordem de nível: n, primeiro filho (-1 se folha), 2t - 1 chaves
+//Os filhos de um nó são consecutivos na ordem de nível, então
+//basta guardar o índice do primeiro.
+
+#define SNAPSHOT_MAGIC 0x42545353
+#define SNAPSHOT_HEADER 4
+
+class BTreeSnapshot
+{
+    private:
+        void* data;
+        long length;
+        const int* nodes;
+        int t;
+        int numberOfNodes;
+        int numberOfKeys;
+
+    public:
+        BTreeSnapshot();
+        ~BTreeSnapshot();
+
+        bool open(const char*);
+        void close();
+
+        bool search(int);
+        int size();
+};
+
+#endif
@@ -0,0 +1,336 @@
+#include <stdio.h>
+#include "BufferPool.h"
+
+//Constrói um buffer pool vazio com capacity quadros para nós de
+//ordem t guardados em file
+BufferPool::BufferPool(PageFile* file, int t, int capacity)
+{
+    if (capacity < 1)
+        capacity = 1;
+
+    this->file = file;
+    this->t = t;
+    this->capacity = capacity;
+
+    page = new int[file->getPageSize() / sizeof(int)];
+
+    numberOfFrames = 0;
+    frames = 0;
+    freeFrames = -1;
+    hand = 0;
+
+    numberOfBuckets = 0;
+    buckets = 0;
+
+    hits = misses = evictions = writes = 0;
+
+    grow();
+}
+
+//Destrói o buffer pool, gravando os nós sujos
+BufferPool::~BufferPool()
+{
+    flush();
+
+    for (int i = 0; i < numberOfFrames; i++)
+        delete frames[i].node;
+
+    delete[] frames;
+    delete[] buckets;
+    delete[] page;
+}
+
+//Aumenta a quantidade de quadros até a capacidade configurada ou,
+//se todos já estiverem fixados, dobra essa quantidade. Os novos
+//quadros entram na lista livre e a tabela hash é refeita.
+void BufferPool::grow()
+{
+    int size = numberOfFrames < capacity ? capacity : 2 * numberOfFrames;
+    Frame* bigger = new Frame[size];
+
+    for (int i = 0; i < numberOfFrames; i++)
+        bigger[i] = frames[i];
+
+    for (int i = size - 1; i >= numberOfFrames; i--)
+    {
+        bigger[i].next = freeFrames;
+        freeFrames = i;
+    }
+
+    delete[] frames;
+    frames = bigger;
+    int old = numberOfFrames;
+    numberOfFrames = size;
+
+    numberOfBuckets = 1;
+    while (numberOfBuckets < 2 * numberOfFrames)
+        numberOfBuckets *= 2;
+
+    delete[] buckets;
+    buckets = new int[numberOfBuckets];
+
+    for (int i = 0; i < numberOfBuckets; i++)
+        buckets[i] = -1;
+
+    for (int i = 0; i < old; i++)
+        if (frames[i].node != 0)
+            link(i);
+}
+
+//Retorna o quadro que guarda a página id ou -1
+int BufferPool::find(int id)
+{
+    int f = buckets[id & (numberOfBuckets - 1)];
+
+    while (f != -1 && frames[f].node->id != id)
+        f = frames[f].next;
+
+    return f;
+}
+
+//Insere o quadro f na tabela hash
+void BufferPool::link(int f)
+{
+    int b = frames[f].node->id & (numberOfBuckets - 1);
+
+    frames[f].next = buckets[b];
+    buckets[b] = f;
+}
+
+//Remove o quadro f da tabela hash
+void BufferPool::unlink(int f)
+{
+    int b = frames[f].node->id & (numberOfBuckets - 1);
+
+    if (buckets[b] == f)
+    {
+        buckets[b] = frames[f].next;
+        return;
+    }
+
+    int prev = buckets[b];
+
+    while (frames[prev].next != f)
+        prev = frames[prev].next;
+
+    frames[prev].next = frames[f].next;
+}
+
+//Grava o nó do quadro f, se estiver sujo
+void BufferPool::writeBack(int f)
+{
+    if (!frames[f].dirty)
+        return;
+
+    frames[f].node->toPage(page, t);
+    file->writePage(frames[f].node->id, page, frames[f].logged);
+
+    frames[f].dirty = false;
+    writes++;
+}
+
+//Escolhe, pelo relógio, um quadro não fixado para ser reutilizado,
+//gravando e liberando o nó que estava nele. Retorna -1 se todos os
+//quadros estiverem fixados.
+int BufferPool::victim()
+{
+    //Duas voltas bastam: na primeira os bits de referência são limpos
+    for (int steps = 0; steps < 2 * numberOfFrames; steps++)
+    {
+        int f = hand;
+
+        hand = (hand + 1) % numberOfFrames;
+
+        if (frames[f].node == 0 || frames[f].pinCount > 0)
+            continue;
+
+        if (frames[f].referenced)
+        {
+            frames[f].referenced = false;
+            continue;
+        }
+
+        writeBack(f);
+        unlink(f);
+
+        delete frames[f].node;
+        frames[f].node = 0;
+        evictions++;
+
+        return f;
+    }
+
+    return -1;
+}
+
+//Coloca o nó em um quadro, fixado uma vez
+int BufferPool::newFrame(BTreeNode* node)
+{
+    int f = -1;
+
+    if (freeFrames == -1)
+    {
+        f = victim();
+
+        //Todos os quadros estão fixados
+        if (f == -1)
+            grow();
+    }
+
+    if (f == -1)
+    {
+        f = freeFrames;
+        freeFrames = frames[f].next;
+    }
+
+    frames[f].node = node;
+    frames[f].pinCount = 1;
+    frames[f].dirty = false;
+    frames[f].referenced = true;
+    frames[f].logged = 0;
+
+    link(f);
+
+    return f;
+}
+
+//Retorna, fixado, o nó da página id, lendo-o do disco somente se
+//ele não estiver no buffer pool
+BTreeNode* BufferPool::fetch(int id)
+{
+    int f = find(id);
+
+    if (f != -1)
+    {
+        hits++;
+
+        frames[f].pinCount++;
+        frames[f].referenced = true;
+
+        return frames[f].node;
+    }
+
+    misses++;
+
+    BTreeNode* node = new (t) BTreeNode(t);
+    node->id = id;
+
+    file->readPage(id, page);
+    node->fromPage(page, t);
+
+    newFrame(node);
+
+    return node;
+}
+
+//Antecipa o acesso ao nó da página id sem fixá-lo: se ele estiver
+//no buffer pool, traz o nó e suas chaves para a cache do
+//processador; se não estiver, pede a página ao sistema operacional
+void BufferPool::prefetch(int id)
+{
+    int f = find(id);
+
+    if (f != -1)
+    {
+        __builtin_prefetch(frames[f].node);
+        __builtin_prefetch(frames[f].node->key);
+    }
+    else
+        file->prefetchPage(id);
+}
+
+//Retorna, fixado e sujo, um nó vazio para a página nova id
+BTreeNode* BufferPool::create(int id)
+{
+    BTreeNode* node = new (t) BTreeNode(t);
+    node->id = id;
+
+    int f = newFrame(node);
+
+    frames[f].dirty = true;
+
+    return node;
+}
+
+//Fixa mais uma vez um nó que já está no buffer pool
+void BufferPool::pin(BTreeNode* node)
+{
+    frames[find(node->id)].pinCount++;
+}
+
+//Desfaz uma fixação; o nó passa a poder ser despejado quando não
+//houver mais nenhuma
+void BufferPool::unpin(BTreeNode* node)
+{
+    int f = find(node->id);
+
+    if (frames[f].pinCount > 0)
+        frames[f].pinCount--;
+}
+
+//Marca o nó como alterado, sem gravá-lo
+void BufferPool::markDirty(BTreeNode* node)
+{
+    frames[find(node->id)].dirty = true;
+}
+
+//Registra a posição no log da imagem mais recente do nó, que
+//precisa estar no disco antes que o nó seja gravado
+void BufferPool::markLogged(BTreeNode* node, long position)
+{
+    frames[find(node->id)].logged = position;
+}
+
+//Retira o nó do buffer pool sem gravá-lo e o libera. Usado quando
+//a página do nó deixa de existir
+void BufferPool::discard(BTreeNode* node)
+{
+    int f = find(node->id);
+
+    unlink(f);
+
+    delete frames[f].node;
+    frames[f].node = 0;
+    frames[f].pinCount = 0;
+    frames[f].dirty = false;
+
+    frames[f].next = freeFrames;
+    freeFrames = f;
+}
+
+//Grava todos os nós sujos e o cabeçalho do arquivo
+void BufferPool::flush()
+{
+    for (int i = 0; i < numberOfFrames; i++)
+        if (frames[i].node != 0)
+            writeBack(i);
+
+    file->sync();
+}
+
+int BufferPool::getHits()
+{
+    return hits;
+}
+
+int BufferPool::getMisses()
+{
+    return misses;
+}
+
+int BufferPool::getEvictions()
+{
+    return evictions;
+}
+
+int BufferPool::getWrites()
+{
+    return writes;
+}
+
+//Imprime os contadores do buffer pool
+void BufferPool::printStats()
+{
+    printf("Acertos: %d Faltas: %d Despejos: %d Escritas: %d\n",
+           hits, misses, evictions, writes);
+}
@@ -0,0 +1,86 @@
+#ifndef BUFFERPOOL_H
+#define BUFFERPOOL_H
+
+#include "BTreeNode.h"
+#include "PageFile.h"
+
+#define DEFAULT_POOL_SIZE 64
+
+//Definição da classe que representa um buffer pool de nós de
+//B-árvore. Mantém até capacity nós em memória, substituídos pelo
+//algoritmo do relógio (CLOCK). Nós alterados são apenas marcados
+//como sujos e só são gravados no despejo ou no flush.
+
+//Definição de um quadro do buffer pool
+class Frame
+{
+    public:
+        BTreeNode* node;
+        int pinCount;
+        bool dirty;
+        bool referenced;
+        long logged;    //posição no log da última imagem do nó (0 se não houver)
+        int next;       //próximo quadro na lista do hash ou na lista livre
+
+        Frame()
+        {
+            node = 0;
+            pinCount = 0;
+            dirty = false;
+            referenced = false;
+            logged = 0;
+            next = -1;
+        }
+};
+
+class BufferPool
+{
+    private:
+        PageFile* file;
+        int t;
+        int* page;          //buffer de uma página
+
+        Frame* frames;
+        int capacity;       //quantidade de quadros configurada
+        int numberOfFrames; //quantidade de quadros alocados
+        int freeFrames;     //primeiro quadro livre (-1 se não houver)
+        int hand;           //ponteiro do relógio
+
+        int* buckets;       //tabela hash página -> quadro
+        int numberOfBuckets;
+
+        int hits;
+        int misses;
+        int evictions;
+        int writes;
+
+        int find(int);
+        void link(int);
+        void unlink(int);
+        int victim();
+        void grow();
+        void writeBack(int);
+        int newFrame(BTreeNode*);
+
+    public:
+        BufferPool(PageFile*, int, int);
+        ~BufferPool();
+
+        BTreeNode* fetch(int);
+        void prefetch(int);
+        BTreeNode* create(int);
+        void pin(BTreeNode*);
+        void unpin(BTreeNode*);
+        void markDirty(BTreeNode*);
+        void markLogged(BTreeNode*, long);
+        void discard(BTreeNode*);
+        void flush();
+
+        int getHits();
+        int getMisses();
+        int getEvictions();
+        int getWrites();
+        void printStats();
+};
+
+#endif
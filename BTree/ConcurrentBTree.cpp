@@ -0,0 +1,370 @@
+#include <stdlib.h>
+#include <new>
+#include <thread>
+#include "BTreeNode.h"
+#include "ConcurrentBTree.h"
+#include "KeySearch.h"
+
+//Aloca, em um único bloco alinhado, um nó de ordem t com suas
+//chaves e filhos
+void* OLCNode::operator new(size_t, int t)
+{
+    void* block;
+    size_t bytes = sizeof(OLCNode) + (2 * t - 1) * sizeof(int) + 2 * t * sizeof(OLCNode*);
+
+    bytes = (bytes + CACHE_LINE - 1) / CACHE_LINE * CACHE_LINE;
+
+    if (posix_memalign(&block, CACHE_LINE, bytes) != 0)
+        throw std::bad_alloc();
+
+    return block;
+}
+
+void OLCNode::operator delete(void* block)
+{
+    free(block);
+}
+
+void OLCNode::operator delete(void* block, int)
+{
+    free(block);
+}
+
+//Constrói um nó folha vazio e destravado
+OLCNode::OLCNode(int t)
+{
+    version.store(0);
+    n = 0;
+    leaf = true;
+
+    //Os filhos vêm primeiro para ficarem alinhados
+    c = (OLCNode**) (this + 1);
+    key = (int*) (c + 2 * t);
+
+    for (int i = 0; i < 2 * t; i++)
+        c[i] = 0;
+}
+
+//Lê a versão do nó para uma leitura otimista. Se um escritor estiver
+//com o nó travado, pede para recomeçar
+unsigned long OLCNode::readLock(bool& restart)
+{
+    unsigned long v = version.load();
+
+    if (v & LOCKED)
+    {
+        std::this_thread::yield();
+        restart = true;
+    }
+
+    return v;
+}
+
+//Confere se o nó não mudou desde a leitura da versão v
+void OLCNode::check(unsigned long v, bool& restart)
+{
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    if (version.load() != v)
+        restart = true;
+}
+
+//Trava o nó para escrita, desde que ele ainda esteja na versão v
+void OLCNode::upgrade(unsigned long v, bool& restart)
+{
+    if (!version.compare_exchange_strong(v, v + LOCKED))
+        restart = true;
+}
+
+//Destrava o nó, gerando uma nova versão
+void OLCNode::writeUnlock()
+{
+    version.fetch_add(LOCKED);
+}
+
+//Constrói uma B-árvore concorrente contendo apenas a raiz vazia
+ConcurrentBTree::ConcurrentBTree(int order)
+{
+    t = order;
+    numberOfKeys.store(0);
+    root.store(new (t) OLCNode(t));
+}
+
+//Destrói a árvore. Nenhuma outra thread pode estar usando-a
+ConcurrentBTree::~ConcurrentBTree()
+{
+    deleteTree(root.load());
+}
+
+void ConcurrentBTree::deleteTree(OLCNode* node)
+{
+    if (!node->leaf)
+    {
+        for (int i = 0; i <= node->n; i++)
+            deleteTree(node->c[i]);
+    }
+
+    delete node;
+}
+
+int ConcurrentBTree::size()
+{
+    return numberOfKeys.load();
+}
+
+//Busca uma chave sem travar nenhum nó. Cada nó é lido entre a
+//leitura e a conferência da sua versão; se algum escritor o alterou
+//nesse meio tempo, a busca recomeça da raiz
+bool ConcurrentBTree::search(int value)
+{
+    while (true)
+    {
+        bool restart = false;
+
+        OLCNode* node = root.load();
+        unsigned long v = node->readLock(restart);
+
+        if (restart || node != root.load())
+            continue;
+
+        while (true)
+        {
+            int n = node->n;
+            int i = keySearch(node->key, n, value);
+            bool found = i < n && node->key[i] == value;
+            bool leaf = node->leaf;
+            OLCNode* child = leaf ? 0 : node->c[i];
+
+            node->check(v, restart);
+            if (restart)
+                break;
+
+            if (found)
+                return true;
+
+            if (leaf)
+                return false;
+
+            unsigned long childVersion = child->readLock(restart);
+
+            //O filho lido ainda é filho deste nó
+            node->check(v, restart);
+            if (restart)
+                break;
+
+            node = child;
+            v = childVersion;
+        }
+    }
+}
+
+//Insere uma chave, se ela ainda não existir. Desce como a busca e
+//quebra proativamente os nós cheios do caminho: trava o pai e o nó,
+//quebra, destrava e recomeça. Como o pai foi visto não cheio nessa
+//mesma versão, ele tem espaço para a mediana. Ao chegar a uma folha
+//com espaço, trava somente ela
+bool ConcurrentBTree::insert(int value)
+{
+    while (true)
+    {
+        bool restart = false;
+
+        OLCNode* node = root.load();
+        unsigned long v = node->readLock(restart);
+
+        if (restart || node != root.load())
+            continue;
+
+        OLCNode* parent = 0;
+        unsigned long parentVersion = 0;
+        int index = 0; //posição de node entre os filhos de parent
+
+        while (true)
+        {
+            if (node->n == 2 * t - 1)
+            {
+                if (parent != 0)
+                {
+                    parent->upgrade(parentVersion, restart);
+                    if (restart)
+                        break;
+                }
+
+                node->upgrade(v, restart);
+                if (restart)
+                {
+                    if (parent != 0)
+                        parent->writeUnlock();
+                    break;
+                }
+
+                if (parent == 0)
+                {
+                    //O nó ainda precisa ser a raiz
+                    if (node != root.load())
+                    {
+                        node->writeUnlock();
+                        break;
+                    }
+
+                    OLCNode* s = new (t) OLCNode(t);
+
+                    s->leaf = false;
+                    s->c[0] = node;
+
+                    splitChild(s, 0, node);
+
+                    root.store(s);
+                }
+                else
+                {
+                    splitChild(parent, index, node);
+
+                    parent->writeUnlock();
+                }
+
+                node->writeUnlock();
+
+                restart = true;
+                break;
+            }
+
+            int n = node->n;
+            int i = keySearch(node->key, n, value);
+            bool found = i < n && node->key[i] == value;
+
+            if (found)
+            {
+                node->check(v, restart);
+                if (restart)
+                    break;
+
+                return false;
+            }
+
+            if (node->leaf)
+            {
+                node->upgrade(v, restart);
+                if (restart)
+                    break;
+
+                for (int j = node->n - 1; j >= i; j--)
+                    node->key[j + 1] = node->key[j];
+
+                node->key[i] = value;
+                node->n++;
+
+                node->writeUnlock();
+
+                numberOfKeys++;
+
+                return true;
+            }
+
+            OLCNode* child = node->c[i];
+
+            node->check(v, restart);
+            if (restart)
+                break;
+
+            unsigned long childVersion = child->readLock(restart);
+
+            node->check(v, restart);
+            if (restart)
+                break;
+
+            parent = node;
+            parentVersion = v;
+            index = i;
+
+            node = child;
+            v = childVersion;
+        }
+    }
+}
+
+//Quebra o nó cheio y, i-ésimo filho de x, em dois e sobe a mediana
+//para x. O chamador deve estar com x e y travados; o novo nó só se
+//torna visível quando x for destravado
+void ConcurrentBTree::splitChild(OLCNode* x, int i, OLCNode* y)
+{
+    OLCNode* z = new (t) OLCNode(t);
+
+    z->leaf = y->leaf;
+    z->n = t - 1;
+
+    for (int j = 0; j < t - 1; j++)
+        z->key[j] = y->key[j + t];
+
+    if (!y->leaf)
+    {
+        for (int j = 0; j < t; j++)
+            z->c[j] = y->c[j + t];
+    }
+    y->n = t - 1;
+
+    for (int j = x->n; j > i; j--)
+        x->c[j + 1] = x->c[j];
+
+    x->c[i + 1] = z;
+
+    for (int j = x->n - 1; j >= i; j--)
+        x->key[j + 1] = x->key[j];
+
+    x->key[i] = y->key[t - 1];
+    x->n++;
+}
+
+//Confere as propriedades da árvore: chaves ordenadas e dentro dos
+//limites dados pelos ancestrais, entre t - 1 e 2t - 1 chaves fora da
+//raiz, todas as folhas na mesma profundidade e a contagem de chaves.
+//Deve ser chamado sem outras threads usando a árvore
+bool ConcurrentBTree::validate()
+{
+    int leafDepth = -1;
+    int count = 0;
+
+    if (!validate(root.load(), -2147483649L, 2147483648L, 0, leafDepth, count))
+        return false;
+
+    return count == numberOfKeys.load();
+}
+
+bool ConcurrentBTree::validate(OLCNode* node, long lo, long hi, int depth, int& leafDepth, int& count)
+{
+    if (node->version.load() & LOCKED)
+        return false;
+
+    if (node->n > 2 * t - 1 || (node != root.load() && node->n < t - 1))
+        return false;
+
+    for (int i = 0; i < node->n; i++)
+    {
+        if (node->key[i] <= lo || node->key[i] >= hi)
+            return false;
+
+        if (i > 0 && node->key[i] <= node->key[i - 1])
+            return false;
+    }
+
+    count += node->n;
+
+    if (node->leaf)
+    {
+        if (leafDepth == -1)
+            leafDepth = depth;
+
+        return leafDepth == depth;
+    }
+
+    for (int i = 0; i <= node->n; i++)
+    {
+        long childLo = i > 0 ? node->key[i - 1] : lo;
+        long childHi = i < node->n ? node->key[i] : hi;
+
+        if (!validate(node->c[i], childLo, childHi, depth + 1, leafDepth, count))
+            return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,66 @@
+#ifndef CONCURRENTBTREE_H
+#define CONCURRENTBTREE_H
+
+#include <stddef.h>
+#include <atomic>
+
+//Definição da classe que representa um nó da B-árvore concorrente.
+//Cada nó tem uma trava com versão: o bit LOCKED indica que um
+//escritor está alterando o nó e cada liberação incrementa a versão.
+//Leitores não travam nada; leem a versão, leem o nó e conferem se a
+//versão continua a mesma, recomeçando a operação se não continuar.
+//Como na BTreeNode, chaves e filhos ficam no mesmo bloco do nó.
+
+#define LOCKED 2
+
+class OLCNode
+{
+    public:
+        std::atomic<unsigned long> version;
+        int n;
+        bool leaf;
+        int* key;
+        OLCNode** c;
+
+        OLCNode(int);
+
+        static void* operator new(size_t, int);
+        static void operator delete(void*);
+        static void operator delete(void*, int);
+
+        unsigned long readLock(bool&);
+        void check(unsigned long, bool&);
+        void upgrade(unsigned long, bool&);
+        void writeUnlock();
+};
+
+//Definição da classe que representa uma B-árvore em memória segura
+//para várias threads, com acoplamento otimista de travas (optimistic
+//lock coupling). As buscas não travam nenhum nó. As inserções descem
+//como as buscas e só travam o nó que alteram e, ao quebrar um nó
+//cheio, também o seu pai. A quebra é proativa, como em
+//BTree::insertNonFull. A remoção não é suportada.
+
+class ConcurrentBTree
+{
+    private:
+        int t; //ordem da b-árvore
+        std::atomic<int> numberOfKeys;
+        std::atomic<OLCNode*> root;
+
+        void splitChild(OLCNode*, int, OLCNode*);
+        void deleteTree(OLCNode*);
+        bool validate(OLCNode*, long, long, int, int&, int&);
+
+    public:
+        ConcurrentBTree(int);
+        ~ConcurrentBTree();
+
+        bool search(int);
+        bool insert(int);
+
+        int size();
+        bool validate();
+};
+
+#endif
@@ -0,0 +1,121 @@
+#include "KeySearch.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define KEYSEARCH_X86
+#endif
+
+//Busca binária sem desvios: reduz [lower, lower + len) até restarem
+//no máximo window chaves, usando movimentações condicionais no lugar
+//de desvios imprevisíveis
+static inline int narrow(const int* key, int& len, int value, int window)
+{
+    int lower = 0;
+
+    while (len > window)
+    {
+        int half = len / 2;
+        bool less = key[lower + half] < value;
+
+        lower = less ? lower + half + 1 : lower;
+        len = less ? len - half - 1 : half;
+    }
+
+    return lower;
+}
+
+//Versão sem SIMD: busca binária sem desvios até o fim
+int keySearchScalar(const int* key, int n, int value)
+{
+    int len = n;
+
+    return narrow(key, len, value, 0);
+}
+
+#ifdef KEYSEARCH_X86
+
+//Versão SSE2: compara 4 chaves por instrução na janela final
+int keySearchSSE2(const int* key, int n, int value)
+{
+    int len = n;
+    int lower = narrow(key, len, value, 16);
+
+    const int* k = key + lower;
+    __m128i v = _mm_set1_epi32(value);
+    int count = 0;
+    int j = 0;
+
+    for (; j + 4 <= len; j += 4)
+    {
+        __m128i lt = _mm_cmplt_epi32(_mm_loadu_si128((const __m128i*) (k + j)), v);
+
+        count += __builtin_popcount(_mm_movemask_ps(_mm_castsi128_ps(lt)));
+    }
+
+    for (; j < len; j++)
+        count += k[j] < value;
+
+    return lower + count;
+}
+
+//Versão AVX2: compara 8 chaves por instrução na janela final
+__attribute__((target("avx2")))
+int keySearchAVX2(const int* key, int n, int value)
+{
+    int len = n;
+    int lower = narrow(key, len, value, 32);
+
+    const int* k = key + lower;
+    __m256i v = _mm256_set1_epi32(value);
+    int count = 0;
+    int j = 0;
+
+    for (; j + 8 <= len; j += 8)
+    {
+        __m256i lt = _mm256_cmpgt_epi32(v, _mm256_loadu_si256((const __m256i*) (k + j)));
+
+        count += __builtin_popcount(_mm256_movemask_ps(_mm256_castsi256_ps(lt)));
+    }
+
+    for (; j < len; j++)
+        count += k[j] < value;
+
+    return lower + count;
+}
+
+#else
+
+int keySearchSSE2(const int* key, int n, int value)
+{
+    return keySearchScalar(key, n, value);
+}
+
+int keySearchAVX2(const int* key, int n, int value)
+{
+    return keySearchScalar(key, n, value);
+}
+
+#endif
+
+//Escolhe a melhor versão suportada pelo processador
+static int (*chooseKeySearch())(const int*, int, int)
+{
+#ifdef KEYSEARCH_X86
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx2"))
+        return keySearchAVX2;
+
+    if (__builtin_cpu_supports("sse2"))
+        return keySearchSSE2;
+#endif
+
+    return keySearchScalar;
+}
+
+static int (*kernel)(const int*, int, int) = chooseKeySearch();
+
+int keySearch(const int* key, int n, int value)
+{
+    return kernel(key, n, value);
+}
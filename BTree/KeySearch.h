@@ -0,0 +1,17 @@
+#ifndef KEYSEARCH_H
+#define KEYSEARCH_H
+
+//Busca de uma chave dentro de um nó. Retorna quantas das n chaves
+//ordenadas são menores do que value, isto é, a posição onde value
+//está ou deveria ser inserida. Uma busca binária sem desvios reduz
+//o intervalo e as chaves restantes são comparadas várias de uma vez
+//com AVX2 ou SSE2. A versão é escolhida na inicialização conforme
+//o processador; sem SIMD, a busca binária vai até o fim.
+
+int keySearch(const int*, int, int);
+
+int keySearchScalar(const int*, int, int);
+int keySearchSSE2(const int*, int, int);
+int keySearchAVX2(const int*, int, int);
+
+#endif
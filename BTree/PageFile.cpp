@@ -0,0 +1,287 @@
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include "PageFile.h"
+#include "WriteAheadLog.h"
+
+#define PAGE_FILE_MAGIC 0x42545245
+
+//Campos do cabeçalho, em ordem, na página 0
+#define HEADER_FIELDS 7
+
+//Constrói um arquivo de páginas ainda fechado
+PageFile::PageFile()
+{
+    file = 0;
+    pageSize = 0;
+    numberOfPages = 0;
+    freeList = 0;
+    log = 0;
+
+    freeLinks = 0;
+    freeLinkCount = freeLinkCapacity = 0;
+
+    rootPage = 0;
+    order = 0;
+    numberOfKeys = 0;
+}
+
+//Fecha o arquivo, gravando o cabeçalho
+PageFile::~PageFile()
+{
+    close();
+
+    delete[] freeLinks;
+}
+
+//Abre um arquivo existente ou cria um novo com páginas de size
+//bytes. Retorna true se o arquivo já existia e tinha um cabeçalho
+//válido; nesse caso o tamanho de página gravado prevalece.
+bool PageFile::open(const char* fileName, int size)
+{
+    close();
+
+    if (size < (int) (HEADER_FIELDS * sizeof(int)))
+        size = HEADER_FIELDS * sizeof(int);
+
+    file = fopen(fileName, "r+b");
+
+    if (file != 0)
+    {
+        int header[HEADER_FIELDS];
+
+        if (fread(header, sizeof(int), HEADER_FIELDS, file) == HEADER_FIELDS &&
+            header[0] == PAGE_FILE_MAGIC)
+        {
+            pageSize = header[1];
+            readHeader();
+
+            return true;
+        }
+
+        fclose(file);
+    }
+
+    file = fopen(fileName, "w+b");
+
+    if (file == 0)
+    {
+        printf("Erro ao abrir o arquivo %s\n", fileName);
+        openTemporary(size);
+
+        return false;
+    }
+
+    pageSize = size;
+    numberOfPages = 1;
+    freeList = 0;
+    writeHeader();
+
+    return false;
+}
+
+//Cria um arquivo temporário, removido automaticamente ao fechar.
+//O tamanho de página nunca é menor do que o cabeçalho.
+void PageFile::openTemporary(int size)
+{
+    close();
+
+    if (size < (int) (HEADER_FIELDS * sizeof(int)))
+        size = HEADER_FIELDS * sizeof(int);
+
+    file = tmpfile();
+    pageSize = size;
+    numberOfPages = 1;
+    freeList = 0;
+    writeHeader();
+}
+
+//Grava o cabeçalho e fecha o arquivo
+void PageFile::close()
+{
+    if (file == 0)
+        return;
+
+    writeHeader();
+    fclose(file);
+
+    file = 0;
+}
+
+int PageFile::getPageSize()
+{
+    return pageSize;
+}
+
+//Lê o cabeçalho da página 0
+void PageFile::readHeader()
+{
+    int header[HEADER_FIELDS];
+
+    fseek(file, 0, SEEK_SET);
+    fread(header, sizeof(int), HEADER_FIELDS, file);
+
+    pageSize = header[1];
+    numberOfPages = header[2];
+    freeList = header[3];
+    rootPage = header[4];
+    order = header[5];
+    numberOfKeys = header[6];
+}
+
+//Grava o cabeçalho na página 0, junto com o encadeamento das
+//páginas liberadas desde a última gravação
+void PageFile::writeHeader()
+{
+    if (log != 0 && log->needsForce())
+        log->force();
+
+    writeFreeLinks();
+
+    char* page = new char[pageSize];
+    int* header = (int*) page;
+
+    memset(page, 0, pageSize);
+
+    header[0] = PAGE_FILE_MAGIC;
+    header[1] = pageSize;
+    header[2] = numberOfPages;
+    header[3] = freeList;
+    header[4] = rootPage;
+    header[5] = order;
+    header[6] = numberOfKeys;
+
+    fseek(file, 0, SEEK_SET);
+    fwrite(page, 1, pageSize, file);
+
+    delete[] page;
+}
+
+//Retorna o número de uma página livre, reaproveitando páginas
+//liberadas antes de aumentar o arquivo
+int PageFile::allocatePage()
+{
+    if (freeList != 0)
+    {
+        int id = freeList;
+        int next;
+
+        //A lista é uma pilha, então os encadeamentos ainda não
+        //gravados são os do começo dela
+        if (freeLinkCount > 0)
+            next = freeLinks[2 * --freeLinkCount + 1];
+        else
+        {
+            fseek(file, (long) id * pageSize, SEEK_SET);
+            fread(&next, sizeof(int), 1, file);
+        }
+
+        freeList = next;
+
+        return id;
+    }
+
+    return numberOfPages++;
+}
+
+//Devolve uma página para a lista de páginas livres. O encadeamento
+//só é gravado na página com o cabeçalho: com log, ele já está
+//registrado no commit da operação que liberou a página
+void PageFile::freePage(int id)
+{
+    if (freeLinkCount == freeLinkCapacity)
+    {
+        freeLinkCapacity = freeLinkCapacity == 0 ? 16 : 2 * freeLinkCapacity;
+
+        int* bigger = new int[2 * freeLinkCapacity];
+
+        for (int i = 0; i < 2 * freeLinkCount; i++)
+            bigger[i] = freeLinks[i];
+
+        delete[] freeLinks;
+        freeLinks = bigger;
+    }
+
+    freeLinks[2 * freeLinkCount] = id;
+    freeLinks[2 * freeLinkCount + 1] = freeList;
+    freeLinkCount++;
+
+    freeList = id;
+}
+
+//Grava em cada página liberada a próxima página livre
+void PageFile::writeFreeLinks()
+{
+    for (int i = 0; i < freeLinkCount; i++)
+    {
+        fseek(file, (long) freeLinks[2 * i] * pageSize, SEEK_SET);
+        fwrite(&freeLinks[2 * i + 1], sizeof(int), 1, file);
+    }
+
+    freeLinkCount = 0;
+}
+
+//Lê a página id para o buffer, que deve ter pageSize bytes
+void PageFile::readPage(int id, void* buffer)
+{
+    fseek(file, (long) id * pageSize, SEEK_SET);
+
+    if (fread(buffer, 1, pageSize, file) != (size_t) pageSize)
+        memset(buffer, 0, pageSize);
+}
+
+//Grava o buffer, de pageSize bytes, na página id. logged é a
+//posição no log da última imagem registrada da página (0 se não
+//houver); o log só é sincronizado se essa imagem ainda não estiver
+//no disco
+void PageFile::writePage(int id, const void* buffer, long logged)
+{
+    if (log != 0 && log->needsForce(logged))
+        log->force();
+
+    fseek(file, (long) id * pageSize, SEEK_SET);
+    fwrite(buffer, 1, pageSize, file);
+}
+
+//Avisa o sistema operacional que a página id será lida em breve,
+//para que a leitura do disco comece sem bloquear
+void PageFile::prefetchPage(int id)
+{
+    posix_fadvise(fileno(file), (long) id * pageSize, pageSize, POSIX_FADV_WILLNEED);
+}
+
+//Grava o cabeçalho e sincroniza o arquivo com o disco
+void PageFile::sync()
+{
+    writeHeader();
+    fflush(file);
+    fsync(fileno(file));
+}
+
+//Associa um log de refazer ao arquivo. Antes de gravar uma página,
+//o log é sincronizado até a última imagem registrada dela, e antes
+//do cabeçalho, por inteiro (write-ahead)
+void PageFile::setLog(WriteAheadLog* log)
+{
+    this->log = log;
+}
+
+//Copia o estado do cabeçalho que é guardado no log
+void PageFile::getState(int* state)
+{
+    state[0] = rootPage;
+    state[1] = numberOfKeys;
+    state[2] = numberOfPages;
+    state[3] = freeList;
+    state[4] = order;
+}
+
+//Restaura o estado do cabeçalho a partir do log
+void PageFile::setState(const int* state)
+{
+    rootPage = state[0];
+    numberOfKeys = state[1];
+    numberOfPages = state[2];
+    freeList = state[3];
+    order = state[4];
+}
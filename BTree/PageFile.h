@@ -0,0 +1,61 @@
+#ifndef PAGEFILE_H
+#define PAGEFILE_H
+
+#include <stdio.h>
+
+class WriteAheadLog;
+
+//Quantidade de campos do estado do cabeçalho guardado no log
+#define PAGE_FILE_STATE 5
+
+//Definição da classe que representa um arquivo de páginas de
+//tamanho fixo. A página 0 é o cabeçalho; as demais guardam nós.
+//Páginas liberadas formam uma lista encadeada para reuso; o
+//encadeamento de uma página liberada fica em memória até a próxima
+//gravação do cabeçalho.
+
+class PageFile
+{
+    private:
+        FILE* file;
+        int pageSize;       //tamanho de cada página em bytes
+        int numberOfPages;  //quantidade de páginas, incluindo o cabeçalho
+        int freeList;       //primeira página livre (0 se não houver)
+        WriteAheadLog* log; //log a sincronizar antes de cada escrita
+
+        int* freeLinks;     //pares (página, próxima livre) ainda não gravados
+        int freeLinkCount;
+        int freeLinkCapacity;
+
+        void readHeader();
+        void writeHeader();
+        void writeFreeLinks();
+
+    public:
+        int rootPage;       //página da raiz
+        int order;          //ordem da b-árvore gravada no arquivo
+        int numberOfKeys;   //quantidade de chaves gravada no arquivo
+
+        PageFile();
+        ~PageFile();
+
+        bool open(const char*, int);
+        void openTemporary(int);
+        void close();
+
+        int getPageSize();
+
+        int allocatePage();
+        void freePage(int);
+
+        void readPage(int, void*);
+        void writePage(int, const void*, long);
+        void prefetchPage(int);
+        void sync();
+
+        void setLog(WriteAheadLog*);
+        void getState(int*);
+        void setState(const int*);
+};
+
+#endif
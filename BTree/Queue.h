@@ -0,0 +1,37 @@
+#ifndef QUEUE_H
+#define QUEUE_H
+
+//Definição de um nó da fila
+class QueueNode
+{
+    public:
+        int page;
+        QueueNode* next;
+        
+        QueueNode(int page)
+        {
+            this->page = page;
+            next = 0;
+        }
+};
+
+//Definição de uma classe que representa uma fila encadeada 
+//de páginas de nós de B-árvore
+class Queue
+{
+    private: 
+        QueueNode* head;
+        QueueNode* tail;
+        int numberOfElements;
+        
+    public:
+        Queue();
+        ~Queue();
+        
+        bool isEmpty();
+        
+        void enqueue(int);
+        int dequeue();
+};
+
+#endif
@@ -0,0 +1,277 @@
+#include <string.h>
+#include <unistd.h>
+#include "PageFile.h"
+#include "WriteAheadLog.h"
+
+//Constrói um log fechado
+WriteAheadLog::WriteAheadLog()
+{
+    file = 0;
+    pageSize = 0;
+
+    buffer = 0;
+    used = 0;
+    capacity = 0;
+
+    appended = 0;
+    durable = 0;
+
+    groupSize = DEFAULT_GROUP_COMMIT;
+    pendingCommits = 0;
+    syncs = 0;
+    recovered = 0;
+}
+
+//Grava os registros pendentes e fecha o log
+WriteAheadLog::~WriteAheadLog()
+{
+    close();
+
+    delete[] buffer;
+}
+
+//Abre, ou cria, o log fileName para páginas de size bytes. Os
+//registros já existentes são mantidos para recover
+bool WriteAheadLog::open(const char* fileName, int size)
+{
+    close();
+
+    file = fopen(fileName, "r+b");
+
+    if (file == 0)
+        file = fopen(fileName, "w+b");
+
+    if (file == 0)
+    {
+        printf("Erro ao abrir o arquivo %s\n", fileName);
+        return false;
+    }
+
+    pageSize = size;
+
+    return true;
+}
+
+//Grava os registros pendentes e fecha o arquivo
+void WriteAheadLog::close()
+{
+    if (file == 0)
+        return;
+
+    force();
+    fclose(file);
+
+    file = 0;
+}
+
+//Define quantos commits são agrupados em cada sincronização
+void WriteAheadLog::setGroupSize(int size)
+{
+    groupSize = size < 1 ? 1 : size;
+}
+
+//Quantidade de sincronizações (fsync) feitas no log
+int WriteAheadLog::getSyncs()
+{
+    return syncs;
+}
+
+//Quantidade de operações refeitas pelo último recover
+int WriteAheadLog::getRecovered()
+{
+    return recovered;
+}
+
+//Soma de verificação simples (FNV-1a) sobre count inteiros
+int WriteAheadLog::checksum(const int* data, int count)
+{
+    unsigned int hash = 2166136261u;
+
+    for (int i = 0; i < count; i++)
+    {
+        hash ^= (unsigned int) data[i];
+        hash *= 16777619u;
+    }
+
+    return (int) hash;
+}
+
+//Acrescenta um registro ao buffer
+void WriteAheadLog::append(int type, int id, const void* data, int length)
+{
+    int recordSize = (4 * sizeof(int)) + length;
+
+    if (used + recordSize > capacity)
+    {
+        int bigger = capacity == 0 ? 4096 : 2 * capacity;
+
+        while (bigger < used + recordSize)
+            bigger *= 2;
+
+        char* grown = new char[bigger];
+
+        if (used > 0)
+            memcpy(grown, buffer, used);
+
+        delete[] buffer;
+
+        buffer = grown;
+        capacity = bigger;
+    }
+
+    int* record = (int*) (buffer + used);
+
+    record[0] = type;
+    record[1] = id;
+    record[2] = length;
+    memcpy(record + 3, data, length);
+    record[3 + length / sizeof(int)] = checksum(record, 3 + length / sizeof(int));
+
+    used += recordSize;
+    appended += recordSize;
+}
+
+//Registra a imagem final da página id. Retorna a posição do
+//registro no log, que deve estar no disco antes que a página seja
+//gravada no arquivo
+long WriteAheadLog::appendPage(int id, const void* page)
+{
+    append(LOG_PAGE, id, page, pageSize);
+
+    return appended;
+}
+
+//Fecha uma operação, registrando o estado do cabeçalho. A cada
+//groupSize commits os registros são gravados e sincronizados
+void WriteAheadLog::commit(const int* state)
+{
+    append(LOG_COMMIT, 0, state, PAGE_FILE_STATE * sizeof(int));
+
+    if (++pendingCommits >= groupSize)
+        force();
+}
+
+//Verifica se há registros que ainda não estão no disco
+bool WriteAheadLog::needsForce()
+{
+    return used > 0;
+}
+
+//Verifica se o log ainda não está no disco até a posição position,
+//devolvida por appendPage
+bool WriteAheadLog::needsForce(long position)
+{
+    return position > durable;
+}
+
+//Grava e sincroniza todos os registros pendentes
+void WriteAheadLog::force()
+{
+    if (file == 0 || used == 0)
+        return;
+
+    fseek(file, 0, SEEK_END);
+    fwrite(buffer, 1, used, file);
+    fflush(file);
+    fsync(fileno(file));
+
+    used = 0;
+    pendingCommits = 0;
+    durable = appended;
+    syncs++;
+}
+
+//Refaz no arquivo de páginas as operações completas do log, na
+//ordem em que foram registradas. A leitura para no primeiro
+//registro incompleto ou corrompido; as páginas de uma operação sem
+//commit são descartadas. Ao final o arquivo é sincronizado e o log,
+//esvaziado. Retorna a quantidade de operações refeitas
+int WriteAheadLog::recover(PageFile* pages)
+{
+    int headerSize = 3 * sizeof(int);
+    int* record = new int[3 + pageSize / sizeof(int) + 1];
+
+    //Páginas da operação corrente, aplicadas somente no commit
+    char* pending = 0;
+    int* pendingIds = 0;
+    int pendingCount = 0;
+    int pendingCapacity = 0;
+    int replayed = 0;
+
+    fseek(file, 0, SEEK_SET);
+
+    while (fread(record, 1, headerSize, file) == (size_t) headerSize)
+    {
+        int length = record[2];
+
+        if (length < 0 || length > pageSize ||
+            fread(record + 3, 1, length + sizeof(int), file) != length + sizeof(int) ||
+            record[3 + length / sizeof(int)] != checksum(record, 3 + length / sizeof(int)))
+            break;
+
+        if (record[0] == LOG_PAGE)
+        {
+            if (pendingCount == pendingCapacity)
+            {
+                int bigger = pendingCapacity == 0 ? 8 : 2 * pendingCapacity;
+                char* grownPages = new char[(long) bigger * pageSize];
+                int* grownIds = new int[bigger];
+
+                if (pendingCount > 0)
+                {
+                    memcpy(grownPages, pending, (long) pendingCount * pageSize);
+                    memcpy(grownIds, pendingIds, pendingCount * sizeof(int));
+                }
+
+                delete[] pending;
+                delete[] pendingIds;
+
+                pending = grownPages;
+                pendingIds = grownIds;
+                pendingCapacity = bigger;
+            }
+
+            memcpy(pending + (long) pendingCount * pageSize, record + 3, pageSize);
+            pendingIds[pendingCount++] = record[1];
+        }
+        else if (record[0] == LOG_COMMIT)
+        {
+            for (int i = 0; i < pendingCount; i++)
+                pages->writePage(pendingIds[i], pending + (long) i * pageSize, 0);
+
+            pages->setState(record + 3);
+
+            pendingCount = 0;
+            replayed++;
+        }
+        else
+            break;
+    }
+
+    pages->sync();
+    truncate();
+
+    delete[] record;
+    delete[] pending;
+    delete[] pendingIds;
+
+    recovered = replayed;
+
+    return replayed;
+}
+
+//Esvazia o log. Só deve ser chamado quando todas as páginas que ele
+//descreve já estiverem sincronizadas no arquivo de páginas
+void WriteAheadLog::truncate()
+{
+    used = 0;
+    pendingCommits = 0;
+    durable = appended;
+
+    fflush(file);
+
+    if (ftruncate(fileno(file), 0) == 0)
+        fsync(fileno(file));
+
+    fseek(file, 0, SEEK_SET);
+}
@@ -0,0 +1,69 @@
+#ifndef WRITEAHEADLOG_H
+#define WRITEAHEADLOG_H
+
+#include <stdio.h>
+
+class PageFile;
+
+#define DEFAULT_GROUP_COMMIT 32
+
+//Tipos de registro do log
+#define LOG_PAGE   1
+#define LOG_COMMIT 2
+
+//Definição da classe que representa um log de refazer (redo log)
+//do arquivo de páginas. Cada operação da árvore grava, ao terminar,
+//a imagem final das páginas que alterou seguida de um registro de
+//commit com o estado do cabeçalho. Os registros ficam em um buffer
+//e só são gravados e sincronizados (fsync) a cada groupSize commits
+//(commit em grupo), ou quando o arquivo de páginas vai gravar uma
+//página cuja última imagem ainda não está no disco. Na abertura, as operações completas do log são refeitas
+//e as incompletas, descartadas.
+//
+//Formato de um registro (inteiros): tipo, página, tamanho do
+//conteúdo em bytes, conteúdo e soma de verificação.
+
+class WriteAheadLog
+{
+    private:
+        FILE* file;
+        int pageSize;
+
+        char* buffer;   //registros ainda não gravados
+        int used;
+        int capacity;
+
+        long appended;  //posição no log do fim do último registro
+        long durable;   //posição até a qual o log está no disco
+
+        int groupSize;
+        int pendingCommits;
+        int syncs;
+        int recovered;
+
+        void append(int, int, const void*, int);
+        static int checksum(const int*, int);
+
+    public:
+        WriteAheadLog();
+        ~WriteAheadLog();
+
+        bool open(const char*, int);
+        void close();
+
+        void setGroupSize(int);
+        int getSyncs();
+        int getRecovered();
+
+        long appendPage(int, const void*);
+        void commit(const int*);
+
+        bool needsForce();
+        bool needsForce(long);
+        void force();
+
+        int recover(PageFile*);
+        void truncate();
+};
+
+#endif
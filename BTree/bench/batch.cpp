@@ -0,0 +1,94 @@
+//Compara, sobre n chaves sorteadas, a inserção e a busca na BTree
+//feitas uma chave por vez (insert, search) com as feitas em lotes
+//(insertBatch, searchBatch), para alguns tamanhos de lote. As
+//quantidades inseridas e encontradas devem coincidir.
+//
+//Compilação, a partir do diretório BTree:
+//  g++ -std=c++11 -O2 -I. bench/batch.cpp BTree.cpp BTreeNode.cpp BufferPool.cpp
+//      PageFile.cpp Queue.cpp BTreeSnapshot.cpp KeySearch.cpp WriteAheadLog.cpp -o batch
+//
+//Uso: batch [quantidade de chaves]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "BTree.h"
+#include "../../Bench.h"
+
+//batchSize 0 usa insert e search, uma chave por vez. As buscas são
+//das mesmas chaves deslocadas de 1, então cerca de metade é encontrada
+static void run(int t, const int* keys, const int* queries, int n, int batchSize)
+{
+    BTree* tree = new BTree(t, 2 * n / (t - 1) + 16);
+    bool* found = new bool[batchSize > 0 ? batchSize : 1];
+    int inserted = 0, hits = 0;
+
+    std::chrono::steady_clock::time_point start = agora();
+
+    if (batchSize == 0)
+    {
+        for (int i = 0; i < n; i++)
+            inserted += tree->insert(keys[i]);
+    }
+    else
+    {
+        for (int i = 0; i < n; i += batchSize)
+            inserted += tree->insertBatch(keys + i, i + batchSize <= n ? batchSize : n - i);
+    }
+
+    double insertTime = segundos(start);
+
+    start = agora();
+
+    if (batchSize == 0)
+    {
+        for (int i = 0; i < n; i++)
+            hits += tree->search(queries[i]);
+    }
+    else
+    {
+        for (int i = 0; i < n; i += batchSize)
+            hits += tree->searchBatch(queries + i, i + batchSize <= n ? batchSize : n - i, found);
+    }
+
+    double searchTime = segundos(start);
+
+    if (batchSize == 0)
+        printf("uma por vez  ");
+    else
+        printf("lote %6d  ", batchSize);
+
+    printf("inserção: %6.2f Mchaves/s  busca: %6.2f Mchaves/s  (%d, %d)\n",
+           n / insertTime / 1e6, n / searchTime / 1e6, inserted, hits);
+
+    delete[] found;
+    delete tree;
+}
+
+int main(int argc, char** argv)
+{
+    int n = argc > 1 ? atoi(argv[1]) : 1000000;
+    int t = BTreeNode::orderFor(4 * CACHE_LINE);
+
+    int* keys = new int[n];
+    int* queries = new int[n];
+
+    semente = 1;
+
+    for (int i = 0; i < n; i++)
+    {
+        keys[i] = proximo() & ~1;
+        queries[i] = keys[i] + (i & 1);
+    }
+
+    printf("t = %d, %d chaves sorteadas\n", t, n);
+
+    run(t, keys, queries, n, 0);
+
+    for (int batchSize = 64; batchSize <= 65536; batchSize *= 16)
+        run(t, keys, queries, n, batchSize);
+
+    delete[] keys;
+    delete[] queries;
+
+    return 0;
+}
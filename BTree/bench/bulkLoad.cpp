@@ -0,0 +1,78 @@
+//Compara a carga de n chaves já ordenadas na BTree feita com um insert
+//por chave com bulkLoad, com as folhas cheias e com 70% de ocupação,
+//e mede a busca de n chaves sorteadas (cerca de metade encontradas)
+//em cada árvore resultante.
+//
+//Compilação, a partir do diretório BTree:
+//  g++ -std=c++11 -O2 -I. bench/bulkLoad.cpp BTree.cpp BTreeNode.cpp BufferPool.cpp
+//      PageFile.cpp Queue.cpp BTreeSnapshot.cpp KeySearch.cpp WriteAheadLog.cpp -o bulkLoad
+//
+//Uso: bulkLoad [quantidade de chaves]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "BTree.h"
+#include "../../Bench.h"
+
+//Busca n chaves sorteadas entre 0 e 2n; retorna quantas encontrou
+static int buscar(BTree* tree, int n, double& tempo)
+{
+    int found = 0;
+
+    semente = 9;
+    std::chrono::steady_clock::time_point start = agora();
+
+    for (int i = 0; i < n; i++)
+        found += tree->search(proximo() % (2 * n));
+
+    tempo = segundos(start);
+
+    return found;
+}
+
+//fill 0 carrega a árvore com insert, chave a chave
+static void run(const char* name, int t, const int* keys, int n, float fill)
+{
+    BTree* tree = new BTree(t, 2 * n / (t - 1) + 16);
+
+    std::chrono::steady_clock::time_point start = agora();
+
+    if (fill == 0)
+    {
+        for (int i = 0; i < n; i++)
+            tree->insert(keys[i]);
+    }
+    else if (!tree->bulkLoad(keys, n, fill))
+        printf("bulkLoad falhou\n");
+
+    double loadTime = segundos(start);
+    double searchTime;
+    int found = buscar(tree, n, searchTime);
+
+    printf("%-16s carga: %6.2f Mchaves/s  busca: %6.2f Mchaves/s  (%d)\n",
+           name, n / loadTime / 1e6, n / searchTime / 1e6, found);
+
+    delete tree;
+}
+
+int main(int argc, char** argv)
+{
+    int n = argc > 1 ? atoi(argv[1]) : 1000000;
+    int t = BTreeNode::orderFor(4 * CACHE_LINE);
+
+    //Chaves pares, em ordem crescente
+    int* keys = new int[n];
+
+    for (int i = 0; i < n; i++)
+        keys[i] = 2 * i;
+
+    printf("t = %d, %d chaves em ordem crescente\n", t, n);
+
+    run("insert", t, keys, n, 0);
+    run("bulkLoad 100%", t, keys, n, 1.0f);
+    run("bulkLoad 70%", t, keys, n, 0.7f);
+
+    delete[] keys;
+
+    return 0;
+}
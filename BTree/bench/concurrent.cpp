@@ -0,0 +1,116 @@
+//Mede a vazão da ConcurrentBTree com 1, 2, 4, ... threads em uma
+//carga mista (90% buscas, 10% inserções) e compara com a BTree
+//protegida por um único mutex. Ao fim de cada rodada confere as
+//propriedades da árvore concorrente com validate(). A BTree usa um
+//arquivo temporário, sem log de refazer, para que a comparação seja
+//com o mutex e não com o fsync do commit em grupo.
+//
+//Compilação, a partir do diretório BTree:
+//  g++ -O2 -pthread -I. bench/concurrent.cpp ConcurrentBTree.cpp BTree.cpp
+//      BTreeNode.cpp BufferPool.cpp PageFile.cpp Queue.cpp BTreeSnapshot.cpp
+//      KeySearch.cpp WriteAheadLog.cpp -o concurrent
+//
+//Uso: concurrent [operações por thread] [máximo de threads]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "BTree.h"
+#include "ConcurrentBTree.h"
+#include "../../Bench.h"
+
+#define KEY_RANGE 4000000
+#define PRELOAD 1000000
+
+//Executa ops operações de cada uma das threads sobre a árvore
+template <class Tree>
+static double run(Tree& tree, int threads, int ops)
+{
+    std::vector<std::thread> workers;
+
+    std::chrono::steady_clock::time_point start = agora();
+
+    for (int w = 0; w < threads; w++)
+    {
+        workers.push_back(std::thread([&tree, w, ops]()
+        {
+            unsigned int seed = 1000 + w;
+
+            for (int i = 0; i < ops; i++)
+            {
+                int key = proximo(seed) % KEY_RANGE;
+
+                if (i % 10 == 0)
+                    tree.insert(key);
+                else
+                    tree.search(key);
+            }
+        }));
+    }
+
+    for (size_t w = 0; w < workers.size(); w++)
+        workers[w].join();
+
+    return (double) threads * ops / segundos(start) / 1e6;
+}
+
+//BTree com um único mutex, como usada hoje pelos servidores
+class LockedBTree
+{
+    private:
+        BTree tree;
+        std::mutex lock;
+
+    public:
+        LockedBTree(int t) : tree(t, PRELOAD) {}
+
+        bool search(int key)
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            return tree.search(key);
+        }
+
+        bool insert(int key)
+        {
+            std::lock_guard<std::mutex> guard(lock);
+            return tree.insert(key);
+        }
+};
+
+int main(int argc, char** argv)
+{
+    int ops = argc > 1 ? atoi(argv[1]) : 1000000;
+    int maxThreads = argc > 2 ? atoi(argv[2]) : std::thread::hardware_concurrency();
+    int t = BTreeNode::orderFor(4 * CACHE_LINE);
+
+    printf("t = %d, %d operações por thread\n", t, ops);
+    printf("threads  concorrente (Mops/s)  mutex (Mops/s)  validate\n");
+
+    for (int threads = 1; threads <= maxThreads; threads *= 2)
+    {
+        ConcurrentBTree* tree = new ConcurrentBTree(t);
+        LockedBTree* locked = new LockedBTree(t);
+
+        unsigned int seed = 1;
+        for (int i = 0; i < PRELOAD; i++)
+        {
+            int key = proximo(seed) % KEY_RANGE;
+
+            tree->insert(key);
+            locked->insert(key);
+        }
+
+        double concurrent = run(*tree, threads, ops);
+        double mutex = run(*locked, threads, ops);
+
+        printf("%7d  %21.2f  %14.2f  %s\n", threads, concurrent, mutex,
+               tree->validate() ? "ok" : "FALHOU");
+
+        delete tree;
+        delete locked;
+    }
+
+    return 0;
+}
@@ -0,0 +1,64 @@
+//Compara a vazão de inserção e busca da BTree com o leiaute de nó
+//em um bloco único e com o leiaute antigo, em três alocações. A
+//árvore fica em um arquivo temporário, sem log de refazer: com o log,
+//cada commit em grupo forçaria o log (fsync) e o tempo medido seria o
+//do disco, não o do leiaute do nó.
+//
+//Compilação, a partir do diretório BTree:
+//  g++ -O2 -I. bench/nodeLayout.cpp BTree.cpp BTreeNode.cpp BufferPool.cpp
+//      PageFile.cpp Queue.cpp BTreeSnapshot.cpp KeySearch.cpp WriteAheadLog.cpp -o nodeLayout
+//  g++ -O2 -DBTREE_SPLIT_NODE -I. bench/nodeLayout.cpp BTree.cpp ... -o nodeLayoutSplit
+//
+//Uso: nodeLayout [quantidade de chaves]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "BTree.h"
+#include "../../Bench.h"
+
+//Mede inserções e buscas de n chaves em uma árvore de ordem t com
+//todos os nós no buffer pool
+static void run(int t, int n)
+{
+    BTree* tree = new BTree(t, 2 * n / (t - 1) + 16);
+
+    semente = 42;
+    std::chrono::steady_clock::time_point start = agora();
+
+    for (int i = 0; i < n; i++)
+        tree->insert(proximo());
+
+    double insertTime = segundos(start);
+
+    semente = 42;
+    start = agora();
+
+    int found = 0;
+    for (int i = 0; i < n; i++)
+        found += tree->search(proximo());
+
+    double searchTime = segundos(start);
+
+    printf("t = %4d  bloco = %5d bytes  inserção: %6.2f Mchaves/s  busca: %6.2f Mchaves/s  (%d)\n",
+           t, BTreeNode::blockSize(t), n / insertTime / 1e6, n / searchTime / 1e6, found);
+
+    delete tree;
+}
+
+int main(int argc, char** argv)
+{
+    int n = argc > 1 ? atoi(argv[1]) : 1000000;
+
+#ifdef BTREE_SPLIT_NODE
+    printf("Leiaute antigo (três alocações), %d chaves\n", n);
+#else
+    printf("Leiaute em bloco único alinhado, %d chaves\n", n);
+#endif
+
+    run(2, n);
+    run(BTreeNode::orderFor(4 * CACHE_LINE), n);
+    run(BTreeNode::orderFor(16 * CACHE_LINE), n);
+    run(BTreeNode::orderFor(4096), n);
+
+    return 0;
+}
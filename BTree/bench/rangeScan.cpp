@@ -0,0 +1,107 @@
+//Compara a leitura de intervalos de chaves na BPlusTree, com scan e as
+//folhas encadeadas, com a única alternativa na BTree: uma busca por
+//chave do intervalo. As duas árvores recebem as mesmas n chaves pares
+//em ordem sorteada; para cada largura w são lidos intervalos de w
+//chaves a partir de posições sorteadas, e as somas das chaves lidas
+//devem coincidir.
+//
+//Compilação, a partir do diretório BTree:
+//  g++ -std=c++11 -O2 -I. bench/rangeScan.cpp BPlusTree.cpp BTree.cpp BTreeNode.cpp
+//      BufferPool.cpp PageFile.cpp Queue.cpp BTreeSnapshot.cpp KeySearch.cpp
+//      WriteAheadLog.cpp -o rangeScan
+//
+//Uso: rangeScan [quantidade de chaves]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "BTree.h"
+#include "BPlusTree.h"
+#include "../../Bench.h"
+
+int main(int argc, char** argv)
+{
+    int n = argc > 1 ? atoi(argv[1]) : 1000000;
+    int t = BTreeNode::orderFor(4 * CACHE_LINE);
+    int poolSize = 2 * n / (t - 1) + 16;
+
+    //Chaves 0, 2, ..., 2(n - 1), embaralhadas
+    int* keys = new int[n];
+
+    for (int i = 0; i < n; i++)
+        keys[i] = 2 * i;
+
+    semente = 3;
+
+    for (int i = n - 1; i > 0; i--)
+    {
+        int j = proximo() % (i + 1);
+        int k = keys[i];
+
+        keys[i] = keys[j];
+        keys[j] = k;
+    }
+
+    BPlusTree* plus = new BPlusTree(t, poolSize);
+    BTree* tree = new BTree(t, poolSize);
+
+    std::chrono::steady_clock::time_point start = agora();
+    for (int i = 0; i < n; i++)
+        plus->insert(keys[i]);
+    double plusInsert = segundos(start);
+
+    start = agora();
+    for (int i = 0; i < n; i++)
+        tree->insert(keys[i]);
+    double treeInsert = segundos(start);
+
+    printf("t = %d, %d chaves\n", t, n);
+    printf("inserção   BPlusTree: %6.2f Mchaves/s  BTree: %6.2f Mchaves/s\n",
+           n / plusInsert / 1e6, n / treeInsert / 1e6);
+
+    for (int w = 10; w <= 10000 && w <= n; w *= 10)
+    {
+        int queries = n / w;
+        long long plusSum = 0, treeSum = 0;
+
+        semente = 5;
+        start = agora();
+
+        for (int q = 0; q < queries; q++)
+        {
+            int lo = 2 * (proximo() % (n - w + 1));
+            RangeScan* scan = plus->scan(lo, lo + 2 * (w - 1));
+            int key;
+
+            while (scan->next(key))
+                plusSum += key;
+
+            delete scan;
+        }
+
+        double plusTime = segundos(start);
+
+        semente = 5;
+        start = agora();
+
+        for (int q = 0; q < queries; q++)
+        {
+            int lo = 2 * (proximo() % (n - w + 1));
+
+            for (int key = lo; key <= lo + 2 * (w - 1); key += 2)
+                if (tree->search(key))
+                    treeSum += key;
+        }
+
+        double treeTime = segundos(start);
+
+        printf("w = %5d  scan: %7.2f Mchaves/s  busca por chave: %6.2f Mchaves/s  %s\n",
+               w, (double) queries * w / plusTime / 1e6, (double) queries * w / treeTime / 1e6,
+               plusSum == treeSum ? "ok" : "DIFERENTE");
+    }
+
+    delete plus;
+    delete tree;
+    delete[] keys;
+
+    return 0;
+}
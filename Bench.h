@@ -0,0 +1,39 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <chrono>
+
+//Funções comuns aos programas dos diretórios bench: um gerador
+//simples e reprodutível de valores pseudoaleatórios (congruencial
+//linear) e a medição do tempo de parede. Cada programa é uma única
+//unidade de tradução, então basta que tudo aqui seja static.
+
+//Estado do gerador usado por proximo(); cada medição o reinicia com
+//a sua semente para repetir a mesma sequência
+static unsigned int semente;
+
+//Próximo valor de um gerador com estado próprio, como o de cada thread
+static inline int proximo(unsigned int& estado)
+{
+    estado = estado * 1103515245u + 12345u;
+
+    return (int) (estado >> 1);
+}
+
+static inline int proximo()
+{
+    return proximo(semente);
+}
+
+static inline std::chrono::steady_clock::time_point agora()
+{
+    return std::chrono::steady_clock::now();
+}
+
+//Segundos decorridos desde inicio
+static inline double segundos(std::chrono::steady_clock::time_point inicio)
+{
+    return std::chrono::duration<double>(agora() - inicio).count();
+}
+
+#endif
@@ -0,0 +1,105 @@
+#ifndef FROZENTREE_H
+#define FROZENTREE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+//Cópia somente leitura dos valores de uma árvore (AvlTree::freeze,
+//BinaryTree::freeze) em um vetor com o layout de Eytzinger: o nó k da
+//árvore binária completa fica em v[k] e os seus filhos em v[2k] e
+//v[2k + 1], como em um heap. Os primeiros níveis, os mais visitados,
+//ficam juntos no início do vetor, e os filhos de um nó são vizinhos.
+//
+//A busca desce sem desvios condicionais (k = 2k + (v[k] < x)) e, a
+//cada passo, pede ao processador a linha de cache dos descendentes de
+//k quatro níveis abaixo, de modo que a latência da memória de um nível
+//se sobrepõe à dos seguintes.
+
+#define FROZEN_LINE  64
+#define FROZEN_AHEAD (FROZEN_LINE / sizeof(int)) //16 descendentes, 4 níveis
+
+class FrozenTree
+{
+    private:
+        int* memory;
+        int* v;  //v[1..n], com v alinhado à linha de cache
+        int n;
+
+        //Não copiável
+        FrozenTree(const FrozenTree&);
+        FrozenTree& operator=(const FrozenTree&);
+
+        //Preenche v em ordem simétrica a partir dos valores em ordem
+        //crescente; a recursão tem a profundidade da árvore completa
+        template <class Iterator>
+        void fill(Iterator& it, int k)
+        {
+            if (k > n)
+                return;
+
+            fill(it, 2 * k);
+            v[k] = *it;
+            ++it;
+            fill(it, 2 * k + 1);
+        }
+
+        //Índice do primeiro valor >= x, ou 0 se não houver
+        int search(int x) const
+        {
+            int k = 1;
+
+            while (k <= n)
+            {
+                __builtin_prefetch(v + k * FROZEN_AHEAD);
+                k = 2 * k + (v[k] < x);
+            }
+
+            //Desfaz os passos à direita feitos depois do último à esquerda
+            return k >> __builtin_ffs(~k);
+        }
+
+    public:
+        //Lê n valores em ordem crescente a partir de first
+        template <class Iterator>
+        FrozenTree(Iterator first, int n)
+        {
+            this->n = n;
+
+            memory = new int[n + 1 + FROZEN_LINE / sizeof(int)];
+            v = (int*) (((uintptr_t) memory + FROZEN_LINE - 1) & ~(uintptr_t) (FROZEN_LINE - 1));
+
+            fill(first, 1);
+        }
+
+        ~FrozenTree()
+        {
+            delete[] memory;
+        }
+
+        bool contains(int x) const
+        {
+            int k = search(x);
+
+            return k != 0 && v[k] == x;
+        }
+
+        //Menor valor >= x, em value; false se não houver
+        bool lowerBound(int x, int& value) const
+        {
+            int k = search(x);
+
+            if (k == 0)
+                return false;
+
+            value = v[k];
+
+            return true;
+        }
+
+        int size() const
+        {
+            return n;
+        }
+};
+
+#endif
@@ -0,0 +1,229 @@
+#ifndef DARYHEAP_H
+#define DARYHEAP_H
+
+#include <iostream>
+#include <stdint.h>
+
+using namespace std;
+
+#define LINHA_CACHE 64
+
+//Heap máximo d-ário, com D filhos por nó escolhido em tempo de
+//compilação. Os filhos do elemento i ficam em D * i + 1, ...,
+//D * i + D. Com D maior a árvore fica mais baixa e cada nível de
+//descer lê um grupo de irmãos contíguo, em vez de um único par.
+//
+//subir e descer são iterativos e movem um "buraco": o elemento
+//deslocado só é escrito uma vez, na posição final, em vez de ser
+//trocado (três atribuições) em cada nível.
+//
+//Com ALINHADO, o vetor é deslocado para que o elemento 1 comece
+//em uma linha de cache. Quando D * sizeof(T) divide o tamanho da
+//linha (ou é múltiplo dele), cada grupo de irmãos fica inteiro em
+//uma linha (ou ocupa linhas inteiras), e achar o maior filho custa
+//no máximo uma falta de cache por nível.
+template <class T, int D = 8, bool ALINHADO = false>
+class DaryHeap
+{
+	private:
+		T* bloco;//Memória alocada
+		T* h;//Início do heap dentro do bloco
+		int numElementos;
+		int max;
+
+		//Índice do maior filho de indice (-1 se for folha). O valor
+		//do maior filho é devolvido em vm, para não ser lido de novo
+		int maiorFilho(int indice, T& vm)
+		{
+			int primeiro = D * indice + 1;
+
+			if (primeiro >= numElementos)
+				return -1;
+
+			int maior = primeiro;
+			vm = h[primeiro];
+
+			if (primeiro + D <= numElementos)
+			{//Grupo completo: o laço tem tamanho fixo
+				if (D == 2)
+				{//Um só desvio: a especulação costuma ganhar
+					if (h[primeiro + 1] > vm)
+					{
+						vm = h[primeiro + 1];
+						maior = primeiro + 1;
+					}
+				}
+				else
+				{//Sem desvios, escolhidos ao acaso com dois ou mais irmãos
+					for (int k = 1; k < D; k++)
+					{
+						T v = h[primeiro + k];
+						bool troca = v > vm;
+
+						maior = troca ? primeiro + k : maior;
+						vm = troca ? v : vm;
+					}
+				}
+			}
+			else
+			{
+				for (int k = primeiro + 1; k < numElementos; k++)
+				{
+					if (h[k] > vm)
+					{
+						vm = h[k];
+						maior = k;
+					}
+				}
+			}
+
+			return maior;
+		}
+
+	public:
+		//Construtor: constrói um heap de tamanho máximo especificado no parâmetro
+		DaryHeap(int max)
+		{
+			this->max = max;
+			numElementos = 0;
+
+			if (!ALINHADO)
+			{
+				bloco = new T[max];
+				h = bloco;
+				return;
+			}
+
+			//Folga para deslocar o início até o alinhamento desejado
+			bloco = new T[max + LINHA_CACHE];
+			h = bloco;
+
+			for (int k = 0; k < LINHA_CACHE; k++)
+			{
+				if ((uintptr_t) (bloco + k + 1) % LINHA_CACHE == 0)
+				{
+					h = bloco + k;
+					break;
+				}
+			}
+		}
+
+		//Destrutor: libera a memória alocada dinamicamente
+		~DaryHeap()
+		{
+			delete[] bloco;
+		}
+
+		int tamanho()
+		{
+			return numElementos;
+		}
+
+		bool vazio()
+		{
+			return numElementos == 0;
+		}
+
+		T topo()
+		{
+			return h[0];
+		}
+
+		//Método que sobe um elemento no heap
+		void subir(int indice)
+		{
+			T valor = h[indice];
+
+			while (indice > 0)
+			{
+				int pai = (indice - 1) / D;
+
+				if (!(valor > h[pai]))
+					break;
+
+				//O pai desce para o buraco
+				h[indice] = h[pai];
+				indice = pai;
+			}
+
+			h[indice] = valor;
+		}
+
+		//Método que desce um elemento no heap
+		void descer(int indice)
+		{
+			T valor = h[indice];
+
+			while (true)
+			{
+				T vm;
+				int j = maiorFilho(indice, vm);
+
+				if (j == -1 || !(vm > valor))
+					break;
+
+				//O maior filho sobe para o buraco
+				h[indice] = vm;
+				indice = j;
+			}
+
+			h[indice] = valor;
+		}
+
+		//Copia os num elementos de v e os transforma em um heap
+		void construirHeap(const T* v, int num)
+		{
+			numElementos = num < max ? num : max;
+
+			for (int i = 0; i < numElementos; i++)
+				h[i] = v[i];
+
+			//O último nó interno é o pai do último elemento
+			if (numElementos > 1)
+				for (int i = (numElementos - 2) / D; i >= 0; i--)
+					descer(i);
+		}
+
+		void imprimir()
+		{
+			if (numElementos == 0)
+				cout << "Heap vazio!";
+			else
+				for (int i = 0; i < numElementos; i++)
+					cout << h[i] << " ";
+
+			cout << endl;
+		}
+
+		void inserir(T p)
+		{
+			if (numElementos < max)//Tem espaço
+			{
+				h[numElementos] = p;
+
+				subir(numElementos++);
+			}
+			else
+				cout << "Overflow\n";
+		}
+
+		T remover()
+		{
+			T val = T();
+
+			if (numElementos > 0)
+			{
+				val = h[0];
+				h[0] = h[--numElementos];
+
+				if (numElementos > 0)
+					descer(0);
+			}
+			else
+				cout << "Underflow\n";
+
+			return val;
+		}
+};
+
+#endif
@@ -0,0 +1,160 @@
+#ifndef FILACONCORRENTE_H
+#define FILACONCORRENTE_H
+
+#include <atomic>
+#include <mutex>
+#include "FilaPrioridade.h"
+
+//Fila de prioridade concorrente relaxada (MultiQueue). Em vez de um
+//único heap atrás de um mutex, há filasPorThread * numThreads heaps
+//(FilaPrioridade), cada um com a sua trava:
+//  - inserir coloca o elemento em um heap sorteado;
+//  - remover sorteia escolhas heaps, compara os seus topos e retira
+//    o melhor deles.
+//Threads diferentes quase sempre usam heaps diferentes, então as
+//operações não se serializam. Em troca, remover devolve um elemento
+//entre os maiores, mas não necessariamente o maior: quanto mais
+//heaps e menos escolhas, maior a vazão e maior o erro de posto.
+//Com um único heap a fila é exata.
+//
+//Quando um heap sorteado está travado por outra thread, outro é
+//sorteado, em vez de esperar.
+template <class T, class Comparador = std::less<T> >
+class FilaConcorrente
+{
+	private:
+		//Heap com a sua trava. A folga afasta as travas de heaps
+		//vizinhos para que não dividam a mesma linha de cache
+		struct Fila
+		{
+			std::mutex trava;
+			FilaPrioridade<T, Comparador> heap;
+			char folga[64];
+		};
+
+		Fila* filas;
+		int numFilas;
+		int escolhas;
+		std::atomic<int> numElementos;
+		Comparador menor;
+
+		//Não copiável
+		FilaConcorrente(const FilaConcorrente&);
+		FilaConcorrente& operator=(const FilaConcorrente&);
+
+		//Gerador xorshift de cada thread
+		static unsigned int sortear()
+		{
+			static thread_local unsigned int estado = 0;
+
+			if (estado == 0)
+				estado = (unsigned int) (size_t) &estado | 1;
+
+			estado ^= estado << 13;
+			estado ^= estado >> 17;
+			estado ^= estado << 5;
+
+			return estado;
+		}
+
+	public:
+		//Construtor: cria filasPorThread heaps para cada uma das
+		//numThreads threads; remover compara escolhas heaps
+		FilaConcorrente(int numThreads, int filasPorThread = 2, int escolhas = 2)
+		{
+			numFilas = numThreads * filasPorThread;
+
+			if (numFilas < 1)
+				numFilas = 1;
+
+			this->escolhas = escolhas < 1 ? 1 : escolhas;
+
+			filas = new Fila[numFilas];
+			numElementos.store(0);
+		}
+
+		//Destrutor: nenhuma outra thread pode estar usando a fila
+		~FilaConcorrente()
+		{
+			delete[] filas;
+		}
+
+		int tamanho()
+		{
+			return numElementos.load();
+		}
+
+		int getNumFilas()
+		{
+			return numFilas;
+		}
+
+		void inserir(const T& p)
+		{
+			while (true)
+			{
+				Fila& f = filas[sortear() % numFilas];
+
+				if (!f.trava.try_lock())
+					continue;
+
+				//O contador muda com a trava do heap, então nunca fica
+				//abaixo da quantidade de elementos que pode ser retirada
+				f.heap.inserir(p);
+				numElementos++;
+
+				f.trava.unlock();
+
+				return;
+			}
+		}
+
+		//Retira um dos maiores elementos em destino. Devolve falso se a
+		//fila estava vazia
+		bool remover(T& destino)
+		{
+			while (numElementos.load() > 0)
+			{
+				//Trava o primeiro heap sorteado e compara o seu topo com o
+				//dos demais sorteados que estiverem livres
+				Fila* melhor = &filas[sortear() % numFilas];
+
+				if (!melhor->trava.try_lock())
+					continue;
+
+				for (int k = 1; k < escolhas; k++)
+				{
+					Fila* outra = &filas[sortear() % numFilas];
+
+					if (outra == melhor || !outra->trava.try_lock())
+						continue;
+
+					if (!outra->heap.vazio() &&
+					    (melhor->heap.vazio() || menor(melhor->heap.topo(), outra->heap.topo())))
+					{
+						melhor->trava.unlock();
+						melhor = outra;
+					}
+					else
+						outra->trava.unlock();
+				}
+
+				if (melhor->heap.vazio())
+				{
+					melhor->trava.unlock();
+					continue;
+				}
+
+				destino = melhor->heap.remover();
+				numElementos--;
+
+				melhor->trava.unlock();
+
+				return true;
+			}
+
+			return false;
+		}
+};
+
+#endif
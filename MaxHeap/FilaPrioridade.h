@@ -0,0 +1,265 @@
+#ifndef FILAPRIORIDADE_H
+#define FILAPRIORIDADE_H
+
+#include <stddef.h>
+#include <new>
+#include <utility>
+#include <functional>
+
+//Fila de prioridade genérica sobre um heap d-ário que cresce sob
+//demanda. O elemento de maior prioridade é o maior segundo
+//Comparador (com std::less, o maior valor, como no MaxHeap); com
+//std::greater a fila passa a devolver o menor.
+//
+//Os elementos ficam em memória não inicializada e só são criados
+//quando inseridos, então T não precisa de construtor padrão e pode
+//ser apenas movível (por exemplo, um std::unique_ptr ou uma
+//estrutura com a prioridade e a carga juntas). emplace constrói o
+//elemento direto no vetor.
+//
+//A capacidade dobra quando o vetor enche; inserir nunca descarta
+//elementos (se faltar memória, std::bad_alloc é lançada). Quando a
+//fila cai para um quarto da capacidade, o vetor é reduzido à
+//metade, mas nunca abaixo do mínimo pedido em reservar. encolher
+//reduz a capacidade ao tamanho atual.
+template <class T, class Comparador = std::less<T>, int D = 4>
+class FilaPrioridade
+{
+	private:
+		T* h;
+		int numElementos;
+		int capacidade;
+		int minimo;//Capacidade mínima pedida em reservar
+		Comparador menor;
+
+		//Não copiável
+		FilaPrioridade(const FilaPrioridade&);
+		FilaPrioridade& operator=(const FilaPrioridade&);
+
+		//Move os elementos para novo, de capacidade nova, e libera o
+		//vetor antigo
+		void trocarVetor(T* novo, int nova)
+		{
+			for (int i = 0; i < numElementos; i++)
+			{
+				new (novo + i) T(std::move(h[i]));
+				h[i].~T();
+			}
+
+			::operator delete(h);
+
+			h = novo;
+			capacidade = nova;
+		}
+
+		//Move os elementos para um vetor de nova capacidade
+		void realocar(int nova)
+		{
+			trocarVetor(static_cast<T*>(::operator new(sizeof(T) * (size_t) nova)), nova);
+		}
+
+		//Constrói um elemento na posição numElementos a partir de args,
+		//sem incrementar numElementos. Se o vetor estiver cheio, o
+		//elemento é construído no vetor novo antes de os antigos serem
+		//movidos, já que args pode se referir a um deles (como em
+		//fila.inserir(fila.topo()))
+		template <class... Args>
+		void acrescentar(Args&&... args)
+		{
+			if (numElementos < capacidade)
+			{
+				new (h + numElementos) T(std::forward<Args>(args)...);
+				return;
+			}
+
+			int nova = capacidade == 0 ? 16 : 2 * capacidade;
+			T* novo = static_cast<T*>(::operator new(sizeof(T) * (size_t) nova));
+
+			try
+			{
+				new (novo + numElementos) T(std::forward<Args>(args)...);
+			}
+			catch (...)
+			{
+				::operator delete(novo);
+				throw;
+			}
+
+			trocarVetor(novo, nova);
+		}
+
+		//Método que sobe um elemento no heap
+		void subir(int indice)
+		{
+			T valor(std::move(h[indice]));
+
+			while (indice > 0)
+			{
+				int pai = (indice - 1) / D;
+
+				if (!menor(h[pai], valor))
+					break;
+
+				//O pai desce para o buraco
+				h[indice] = std::move(h[pai]);
+				indice = pai;
+			}
+
+			h[indice] = std::move(valor);
+		}
+
+		//Método que desce um elemento no heap
+		void descer(int indice)
+		{
+			T valor(std::move(h[indice]));
+
+			while (true)
+			{
+				int primeiro = D * indice + 1;
+
+				if (primeiro >= numElementos)
+					break;
+
+				int ultimo = primeiro + D < numElementos ? primeiro + D : numElementos;
+				int maior = primeiro;
+
+				for (int k = primeiro + 1; k < ultimo; k++)
+					if (menor(h[maior], h[k]))
+						maior = k;
+
+				if (!menor(valor, h[maior]))
+					break;
+
+				//O maior filho sobe para o buraco
+				h[indice] = std::move(h[maior]);
+				indice = maior;
+			}
+
+			h[indice] = std::move(valor);
+		}
+
+	public:
+		//Construtor: cria uma fila vazia com espaço para capacidadeInicial
+		//elementos, sem fixar um mínimo
+		FilaPrioridade(int capacidadeInicial = 0, const Comparador& comparador = Comparador())
+			: menor(comparador)
+		{
+			h = 0;
+			numElementos = 0;
+			capacidade = 0;
+			minimo = 0;
+
+			if (capacidadeInicial > 0)
+				realocar(capacidadeInicial);
+		}
+
+		//Destrutor: destrói os elementos restantes e libera o vetor
+		~FilaPrioridade()
+		{
+			for (int i = 0; i < numElementos; i++)
+				h[i].~T();
+
+			::operator delete(h);
+		}
+
+		int tamanho() const
+		{
+			return numElementos;
+		}
+
+		bool vazio() const
+		{
+			return numElementos == 0;
+		}
+
+		int getCapacidade() const
+		{
+			return capacidade;
+		}
+
+		//Elemento de maior prioridade. A fila não pode estar vazia
+		const T& topo() const
+		{
+			return h[0];
+		}
+
+		void inserir(const T& p)
+		{
+			acrescentar(p);
+			subir(numElementos++);
+		}
+
+		void inserir(T&& p)
+		{
+			acrescentar(std::move(p));
+			subir(numElementos++);
+		}
+
+		//Constrói o elemento no próprio vetor a partir de args
+		template <class... Args>
+		void emplace(Args&&... args)
+		{
+			acrescentar(std::forward<Args>(args)...);
+			subir(numElementos++);
+		}
+
+		//Retira e devolve o elemento de maior prioridade. A fila não
+		//pode estar vazia
+		T remover()
+		{
+			T val(std::move(h[0]));
+
+			numElementos--;
+
+			if (numElementos > 0)
+			{
+				h[0] = std::move(h[numElementos]);
+				descer(0);
+			}
+
+			h[numElementos].~T();
+
+			if (numElementos <= capacidade / 4 && capacidade / 2 >= minimo && capacidade > 16)
+				realocar(capacidade / 2);
+
+			return val;
+		}
+
+		//Garante capacidade para n elementos e impede que a fila
+		//encolha automaticamente abaixo disso
+		void reservar(int n)
+		{
+			minimo = n;
+
+			if (n > capacidade)
+				realocar(n);
+		}
+
+		//Reduz a capacidade ao tamanho atual (ou ao mínimo reservado)
+		void encolher()
+		{
+			int nova = numElementos > minimo ? numElementos : minimo;
+
+			if (nova < capacidade)
+				realocar(nova);
+		}
+
+		//Transforma o conteúdo atual em um heap; usado depois de
+		//inserir vários elementos com inserirSemOrdem
+		void construirHeap()
+		{
+			if (numElementos > 1)
+				for (int i = (numElementos - 2) / D; i >= 0; i--)
+					descer(i);
+		}
+
+		//Acrescenta um elemento sem restaurar a propriedade de heap.
+		//Deve ser seguido de construirHeap antes de topo ou remover
+		void inserirSemOrdem(T&& p)
+		{
+			acrescentar(std::move(p));
+			numElementos++;
+		}
+};
+
+#endif
@@ -0,0 +1,284 @@
+#ifndef HEAPINDEXADO_H
+#define HEAPINDEXADO_H
+
+#include <functional>
+
+//Fila de prioridade indexada: cada elemento é identificado por um
+//inteiro não negativo (o handle, por exemplo o número de um vértice
+//ou de uma tarefa) e o heap guarda, para cada handle, a sua posição
+//atual. Assim é possível alterar a prioridade de um elemento
+//(atualizar), retirá-lo (apagar) ou saber se ele está na fila
+//(contem) sem procurá-lo, em O(log n), em vez de inserir duplicatas
+//e descartar as entradas vencidas.
+//
+//O topo é o handle de maior prioridade segundo Comparador (com
+//std::less, a maior; com std::greater, a menor, como em Dijkstra).
+//Os vetores por handle crescem sob demanda até o maior handle usado.
+template <class P, class Comparador = std::less<P>, int D = 4>
+class HeapIndexado
+{
+	private:
+		int* h;//Handles, na ordem do heap
+		int numElementos;
+		int capacidade;//Capacidade de h
+
+		P* prioridades;//Prioridade de cada handle
+		int* posicao;//Posição de cada handle em h (-1 se não estiver na fila)
+		int numHandles;//Tamanho de prioridades e posicao
+
+		Comparador menor;
+
+		//Não copiável
+		HeapIndexado(const HeapIndexado&);
+		HeapIndexado& operator=(const HeapIndexado&);
+
+		//Garante que handle tenha posição e prioridade
+		void crescerHandles(int handle)
+		{
+			if (handle < numHandles)
+				return;
+
+			int novo = numHandles == 0 ? 16 : 2 * numHandles;
+
+			while (novo <= handle)
+				novo *= 2;
+
+			P* novasPrioridades = new P[novo];
+			int* novaPosicao = new int[novo];
+
+			for (int i = 0; i < numHandles; i++)
+			{
+				novasPrioridades[i] = prioridades[i];
+				novaPosicao[i] = posicao[i];
+			}
+
+			for (int i = numHandles; i < novo; i++)
+				novaPosicao[i] = -1;
+
+			delete[] prioridades;
+			delete[] posicao;
+
+			prioridades = novasPrioridades;
+			posicao = novaPosicao;
+			numHandles = novo;
+		}
+
+		//Garante espaço no heap para mais um handle
+		void crescer()
+		{
+			if (numElementos < capacidade)
+				return;
+
+			capacidade = capacidade == 0 ? 16 : 2 * capacidade;
+
+			int* novo = new int[capacidade];
+
+			for (int i = 0; i < numElementos; i++)
+				novo[i] = h[i];
+
+			delete[] h;
+			h = novo;
+		}
+
+		//Coloca handle na posição indice do heap
+		void colocar(int indice, int handle)
+		{
+			h[indice] = handle;
+			posicao[handle] = indice;
+		}
+
+		//Método que sobe um elemento no heap
+		void subir(int indice)
+		{
+			int handle = h[indice];
+
+			while (indice > 0)
+			{
+				int pai = (indice - 1) / D;
+
+				if (!menor(prioridades[h[pai]], prioridades[handle]))
+					break;
+
+				//O pai desce para o buraco
+				colocar(indice, h[pai]);
+				indice = pai;
+			}
+
+			colocar(indice, handle);
+		}
+
+		//Método que desce um elemento no heap
+		void descer(int indice)
+		{
+			int handle = h[indice];
+
+			while (true)
+			{
+				int primeiro = D * indice + 1;
+
+				if (primeiro >= numElementos)
+					break;
+
+				int ultimo = primeiro + D < numElementos ? primeiro + D : numElementos;
+				int maior = primeiro;
+
+				for (int k = primeiro + 1; k < ultimo; k++)
+					if (menor(prioridades[h[maior]], prioridades[h[k]]))
+						maior = k;
+
+				if (!menor(prioridades[handle], prioridades[h[maior]]))
+					break;
+
+				//O maior filho sobe para o buraco
+				colocar(indice, h[maior]);
+				indice = maior;
+			}
+
+			colocar(indice, handle);
+		}
+
+		//Retira o elemento da posição indice, preenchendo-a com o último
+		void retirar(int indice)
+		{
+			int handle = h[indice];
+
+			posicao[handle] = -1;
+			numElementos--;
+
+			if (indice == numElementos)
+				return;
+
+			int ultimo = h[numElementos];
+
+			colocar(indice, ultimo);
+
+			//O último pode ter prioridade maior ou menor que a do retirado
+			subir(indice);
+			descer(posicao[ultimo]);
+		}
+
+	public:
+		//Construtor: cria uma fila vazia com espaço para handles de 0 a
+		//numHandles - 1 (os vetores crescem se um handle maior for usado)
+		HeapIndexado(int numHandles = 0, const Comparador& comparador = Comparador())
+			: menor(comparador)
+		{
+			h = 0;
+			numElementos = 0;
+			capacidade = 0;
+
+			prioridades = 0;
+			posicao = 0;
+			this->numHandles = 0;
+
+			if (numHandles > 0)
+				crescerHandles(numHandles - 1);
+		}
+
+		//Destrutor: libera a memória alocada dinamicamente
+		~HeapIndexado()
+		{
+			delete[] h;
+			delete[] prioridades;
+			delete[] posicao;
+		}
+
+		int tamanho() const
+		{
+			return numElementos;
+		}
+
+		bool vazio() const
+		{
+			return numElementos == 0;
+		}
+
+		//Verifica se o handle está na fila
+		bool contem(int handle) const
+		{
+			return handle >= 0 && handle < numHandles && posicao[handle] != -1;
+		}
+
+		//Prioridade de um handle que está na fila
+		const P& prioridade(int handle) const
+		{
+			return prioridades[handle];
+		}
+
+		//Handle de maior prioridade. A fila não pode estar vazia
+		int topo() const
+		{
+			return h[0];
+		}
+
+		//Insere o handle com prioridade p. Se o handle já estiver na
+		//fila, apenas atualiza a prioridade. Devolve falso, sem alterar
+		//nada, se o handle for negativo
+		bool inserir(int handle, const P& p)
+		{
+			if (handle < 0)
+				return false;
+
+			if (contem(handle))
+				return atualizar(handle, p);
+
+			//p pode ser a prioridade de outro handle, e crescerHandles
+			//libera o vetor antigo
+			P valor(p);
+
+			crescerHandles(handle);
+			crescer();
+
+			prioridades[handle] = valor;
+			colocar(numElementos, handle);
+
+			subir(numElementos++);
+
+			return true;
+		}
+
+		//Altera a prioridade de um handle que está na fila, subindo ou
+		//descendo o elemento conforme ela aumente ou diminua. Devolve
+		//falso, sem alterar nada, se ele não estava na fila
+		bool atualizar(int handle, const P& p)
+		{
+			if (!contem(handle))
+				return false;
+
+			bool aumentou = menor(prioridades[handle], p);
+
+			prioridades[handle] = p;
+
+			if (aumentou)
+				subir(posicao[handle]);
+			else
+				descer(posicao[handle]);
+
+			return true;
+		}
+
+		//Retira da fila um handle qualquer. Devolve falso se ele não
+		//estava na fila
+		bool apagar(int handle)
+		{
+			if (!contem(handle))
+				return false;
+
+			retirar(posicao[handle]);
+
+			return true;
+		}
+
+		//Retira e devolve o handle de maior prioridade. A fila não pode
+		//estar vazia
+		int remover()
+		{
+			int handle = h[0];
+
+			retirar(0);
+
+			return handle;
+		}
+};
+
+#endif
@@ -0,0 +1,284 @@
+#ifndef ORDENACAO_H
+#define ORDENACAO_H
+
+#include <functional>
+#include <thread>
+#include <utility>
+
+//Algoritmos sobre um vetor tratado como heap d-ário (os filhos de i
+//são D * i + 1, ..., D * i + D), com a mesma descida por buraco do
+//DaryHeap. O heap é de máximo segundo Comparador; com std::less, os
+//vetores ficam em ordem crescente, como em std::sort.
+//
+//  heapsort               ordena o vetor inteiro, sem memória extra
+//  ordenarParcial         deixa os k menores, em ordem, no início
+//  construirHeap          algoritmo de Floyd
+//  construirHeapParalelo  algoritmo de Floyd com as subárvores de um
+//                         nível distribuídas entre threads
+//  TopK                   guarda os k maiores de uma sequência lida
+//                         aos poucos
+
+//Desce o elemento v[indice] no heap v[0..n)
+template <class T, class Comparador, int D>
+void descerHeap(T* v, int n, int indice, Comparador menor)
+{
+	T valor(std::move(v[indice]));
+
+	while (true)
+	{
+		int primeiro = D * indice + 1;
+
+		if (primeiro >= n)
+			break;
+
+		int ultimo = primeiro + D < n ? primeiro + D : n;
+		int maior = primeiro;
+
+		for (int k = primeiro + 1; k < ultimo; k++)
+			if (menor(v[maior], v[k]))
+				maior = k;
+
+		if (!menor(valor, v[maior]))
+			break;
+
+		//O maior filho sobe para o buraco
+		v[indice] = std::move(v[maior]);
+		indice = maior;
+	}
+
+	v[indice] = std::move(valor);
+}
+
+//Transforma v[0..n) em um heap, do último nó interno até a raiz
+template <class T, class Comparador, int D>
+void construirHeap(T* v, int n, Comparador menor)
+{
+	if (n > 1)
+		for (int i = (n - 2) / D; i >= 0; i--)
+			descerHeap<T, Comparador, D>(v, n, i, menor);
+}
+
+template <class T>
+void construirHeap(T* v, int n)
+{
+	construirHeap<T, std::less<T>, 4>(v, n, std::less<T>());
+}
+
+//Transforma em heap a subárvore de raiz r do heap v[0..n). Os nós de
+//uma mesma profundidade da subárvore são contíguos no vetor, então
+//ela é percorrida nível a nível, de baixo para cima
+template <class T, class Comparador, int D>
+void construirSubarvore(T* v, int n, int r, Comparador menor)
+{
+	//Intervalo [inicio[j], fim[j]) do nível j da subárvore
+	int inicio[32];
+	int fim[32];
+	long largura = 1;
+	int niveis = 0;
+
+	for (long i = r; i < n; i = D * i + 1, largura *= D)
+	{
+		inicio[niveis] = (int) i;
+		fim[niveis] = (int) (i + largura < n ? i + largura : n);
+		niveis++;
+	}
+
+	//O último nível só tem folhas
+	for (int j = niveis - 2; j >= 0; j--)
+		for (int i = fim[j] - 1; i >= inicio[j]; i--)
+			descerHeap<T, Comparador, D>(v, n, i, menor);
+}
+
+//Executada por cada thread: constrói as subárvores de raiz
+//primeira, primeira + passo, ... até ultima
+template <class T, class Comparador, int D>
+void construirSubarvores(T* v, int n, int primeira, int ultima, int passo, Comparador menor)
+{
+	for (int r = primeira; r < ultima; r += passo)
+		construirSubarvore<T, Comparador, D>(v, n, r, menor);
+}
+
+//Constrói o heap com numThreads threads. As subárvores de um nível
+//com pelo menos 4 * numThreads nós são independentes e divididas
+//entre as threads; os poucos nós acima desse nível são descidos
+//depois, sequencialmente, como no algoritmo de Floyd
+template <class T, class Comparador, int D>
+void construirHeapParalelo(T* v, int n, int numThreads, Comparador menor)
+{
+	if (numThreads <= 1 || n < 4096)
+	{
+		construirHeap<T, Comparador, D>(v, n, menor);
+		return;
+	}
+
+	//Primeiro nível com nós suficientes
+	long inicio = 0;
+	long largura = 1;
+
+	while (largura < 4 * numThreads && D * inicio + 1 < n)
+	{
+		inicio = D * inicio + 1;
+		largura *= D;
+	}
+
+	long fim = inicio + largura < n ? inicio + largura : n;
+
+	std::thread** threads = new std::thread*[numThreads];
+
+	for (int t = 0; t < numThreads; t++)
+		threads[t] = new std::thread(construirSubarvores<T, Comparador, D>, v, n,
+		                             (int) inicio + t, (int) fim, numThreads, menor);
+
+	for (int t = 0; t < numThreads; t++)
+	{
+		threads[t]->join();
+		delete threads[t];
+	}
+
+	delete[] threads;
+
+	for (long i = inicio - 1; i >= 0; i--)
+		descerHeap<T, Comparador, D>(v, n, (int) i, menor);
+}
+
+template <class T>
+void construirHeapParalelo(T* v, int n, int numThreads)
+{
+	construirHeapParalelo<T, std::less<T>, 4>(v, n, numThreads, std::less<T>());
+}
+
+//Ordena v[0..n): constrói o heap e move o maior para o fim da parte
+//ainda não ordenada, n - 1 vezes
+template <class T, class Comparador, int D>
+void heapsort(T* v, int n, Comparador menor)
+{
+	construirHeap<T, Comparador, D>(v, n, menor);
+
+	for (int fim = n - 1; fim > 0; fim--)
+	{
+		std::swap(v[0], v[fim]);
+		descerHeap<T, Comparador, D>(v, fim, 0, menor);
+	}
+}
+
+template <class T>
+void heapsort(T* v, int n)
+{
+	heapsort<T, std::less<T>, 4>(v, n, std::less<T>());
+}
+
+//Coloca em v[0..k), em ordem, os k menores elementos de v[0..n); o
+//restante fica em v[k..n), em ordem qualquer. Mantém em v[0..k) um
+//heap com os k menores vistos: cada elemento seguinte menor que a
+//raiz toma o lugar dela. Custa O(n log k)
+template <class T, class Comparador, int D>
+void ordenarParcial(T* v, int n, int k, Comparador menor)
+{
+	if (k > n)
+		k = n;
+
+	if (k <= 0)
+		return;
+
+	construirHeap<T, Comparador, D>(v, k, menor);
+
+	for (int i = k; i < n; i++)
+	{
+		if (menor(v[i], v[0]))
+		{
+			std::swap(v[i], v[0]);
+			descerHeap<T, Comparador, D>(v, k, 0, menor);
+		}
+	}
+
+	for (int fim = k - 1; fim > 0; fim--)
+	{
+		std::swap(v[0], v[fim]);
+		descerHeap<T, Comparador, D>(v, fim, 0, menor);
+	}
+}
+
+template <class T>
+void ordenarParcial(T* v, int n, int k)
+{
+	ordenarParcial<T, std::less<T>, 4>(v, n, k, std::less<T>());
+}
+
+//Guarda os k maiores elementos (segundo Comparador) de uma sequência
+//oferecida um a um, sem guardar a sequência. Os k ficam em um heap
+//cuja raiz é o menor deles, o primeiro a ser trocado
+template <class T, class Comparador = std::less<T>, int D = 4>
+class TopK
+{
+	private:
+		//Inverte o comparador: a raiz do heap é o menor dos k
+		struct Inverso
+		{
+			Comparador menor;
+
+			bool operator()(const T& a, const T& b) const
+			{
+				return menor(b, a);
+			}
+		};
+
+		T* h;
+		int k;
+		int numElementos;
+		Inverso maior;
+
+		//Não copiável
+		TopK(const TopK&);
+		TopK& operator=(const TopK&);
+
+	public:
+		TopK(int k, const Comparador& comparador = Comparador())
+		{
+			this->k = k;
+			numElementos = 0;
+			h = new T[k > 0 ? k : 1];
+			maior.menor = comparador;
+		}
+
+		~TopK()
+		{
+			delete[] h;
+		}
+
+		int tamanho()
+		{
+			return numElementos;
+		}
+
+		//Considera o elemento p
+		void oferecer(const T& p)
+		{
+			if (numElementos < k)
+			{
+				//Enche o vetor e só então o transforma em heap
+				h[numElementos++] = p;
+
+				if (numElementos == k)
+					construirHeap<T, Inverso, D>(h, k, maior);
+			}
+			else if (k > 0 && maior.menor(h[0], p))
+			{
+				h[0] = p;
+				descerHeap<T, Inverso, D>(h, k, 0, maior);
+			}
+		}
+
+		//Copia para saida os elementos guardados, do maior para o menor
+		int resultado(T* saida)
+		{
+			for (int i = 0; i < numElementos; i++)
+				saida[i] = h[i];
+
+			//Ordenar pelo inverso deixa os maiores primeiro
+			heapsort<T, Inverso, D>(saida, numElementos, maior);
+
+			return numElementos;
+		}
+};
+
+#endif
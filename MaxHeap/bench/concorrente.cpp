@@ -0,0 +1,235 @@
+//Mede a vazão da FilaConcorrente com 1, 2, 4, ... threads em uma
+//carga com metade inserções e metade remoções sobre uma fila
+//pré-carregada, e compara com um único MaxHeap protegido por um
+//mutex. Depois mede o erro de posto da FilaConcorrente: para cada
+//remoção, quantos elementos da fila eram maiores que o removido
+//(0 em uma fila exata). O erro é medido com uma só thread, sorteando
+//os heaps como fariam numThreads threads.
+//
+//Compilação, a partir do diretório MaxHeap:
+//  g++ -std=c++11 -O2 -pthread -I. bench/concorrente.cpp MaxHeap.cpp -o concorrente
+//
+//Uso: concorrente [operações por thread] [máximo de threads]
+
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include "MaxHeap.h"
+#include "FilaConcorrente.h"
+#include "../../Bench.h"
+
+#define PRE_CARGA 1000000
+
+//MaxHeap compartilhado atrás de um mutex
+class HeapTravado
+{
+	private:
+		MaxHeap heap;
+		std::mutex trava;
+		int numElementos;
+
+	public:
+		HeapTravado(int max) : heap(max)
+		{
+			numElementos = 0;
+		}
+
+		void inserir(int p)
+		{
+			std::lock_guard<std::mutex> guarda(trava);
+
+			heap.inserir(p);
+			numElementos++;
+		}
+
+		bool remover(int& destino)
+		{
+			std::lock_guard<std::mutex> guarda(trava);
+
+			if (numElementos == 0)
+				return false;
+
+			destino = heap.remover();
+			numElementos--;
+
+			return true;
+		}
+};
+
+//Cada thread alterna, ao acaso, inserções e remoções
+template <class Fila>
+static void trabalhar(Fila* fila, int operacoes, unsigned int semente)
+{
+	for (int i = 0; i < operacoes; i++)
+	{
+		int v = proximo(semente);
+
+		if (v & 1)
+			fila->inserir(v);
+		else
+			fila->remover(v);
+	}
+}
+
+//Executa a carga com numThreads threads e devolve milhões de
+//operações por segundo
+template <class Fila>
+static double medir(Fila* fila, int numThreads, int operacoes)
+{
+	unsigned int semente = 1;
+
+	for (int i = 0; i < PRE_CARGA; i++)
+		fila->inserir(proximo(semente));
+
+	std::thread** threads = new std::thread*[numThreads];
+	std::chrono::steady_clock::time_point inicio = std::chrono::steady_clock::now();
+
+	for (int i = 0; i < numThreads; i++)
+		threads[i] = new std::thread(trabalhar<Fila>, fila, operacoes, 1000u + i);
+
+	for (int i = 0; i < numThreads; i++)
+	{
+		threads[i]->join();
+		delete threads[i];
+	}
+
+	double segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+
+	delete[] threads;
+
+	return (double) numThreads * operacoes / segundos / 1e6;
+}
+
+//Árvore de Fenwick sobre os valores 0..n-1 presentes na fila, para
+//contar quantos são maiores que o removido
+class Contador
+{
+	private:
+		int* arvore;
+		int n;
+
+	public:
+		Contador(int n)
+		{
+			this->n = n;
+			arvore = new int[n + 1];
+
+			for (int i = 0; i <= n; i++)
+				arvore[i] = 0;
+		}
+
+		~Contador()
+		{
+			delete[] arvore;
+		}
+
+		void somar(int valor, int delta)
+		{
+			for (int i = valor + 1; i <= n; i += i & -i)
+				arvore[i] += delta;
+		}
+
+		//Quantidade de valores presentes menores ou iguais a valor
+		int ate(int valor)
+		{
+			int soma = 0;
+
+			for (int i = valor + 1; i > 0; i -= i & -i)
+				soma += arvore[i];
+
+			return soma;
+		}
+};
+
+//Erro de posto médio e máximo das remoções sobre uma fila com n
+//elementos distintos, com metade inserções e metade remoções
+static void erroDePosto(int numThreads, int filasPorThread, int escolhas, int n)
+{
+	FilaConcorrente<int> fila(numThreads, filasPorThread, escolhas);
+	Contador presentes(2 * n);
+	int proximoValor = 0;
+	unsigned int semente = 5;
+
+	//Os valores são distintos e embaralhados: v * 7919 % (2n)
+	for (; proximoValor < n; proximoValor++)
+	{
+		int v = (int) ((long long) proximoValor * 7919 % (2 * n));
+
+		fila.inserir(v);
+		presentes.somar(v, 1);
+	}
+
+	long long soma = 0;
+	int maximo = 0;
+	int remocoes = 0;
+
+	for (int i = 0; i < n; i++)
+	{
+		if ((proximo(semente) & 1) && proximoValor < 2 * n)
+		{
+			int v = (int) ((long long) proximoValor++ * 7919 % (2 * n));
+
+			fila.inserir(v);
+			presentes.somar(v, 1);
+		}
+		else
+		{
+			int v;
+
+			fila.remover(v);
+
+			int erro = fila.tamanho() + 1 - presentes.ate(v);
+
+			presentes.somar(v, -1);
+
+			soma += erro;
+			if (erro > maximo)
+				maximo = erro;
+
+			remocoes++;
+		}
+	}
+
+	printf("  %2d threads, %d heaps por thread, %d escolhas: erro médio %8.2f  máximo %6d\n",
+	       numThreads, filasPorThread, escolhas, (double) soma / remocoes, maximo);
+}
+
+int main(int argc, char** argv)
+{
+	int operacoes = argc > 1 ? atoi(argv[1]) : 1000000;
+	int maxThreads = argc > 2 ? atoi(argv[2]) : (int) std::thread::hardware_concurrency();
+
+	if (maxThreads < 1)
+		maxThreads = 1;
+
+	printf("Vazão (milhões de operações por segundo), %d operações por thread\n", operacoes);
+
+	for (int p = 1; p <= maxThreads; p *= 2)
+	{
+		HeapTravado* travado = new HeapTravado(PRE_CARGA + p * operacoes);
+		FilaConcorrente<int>* fila2 = new FilaConcorrente<int>(p, 2, 2);
+		FilaConcorrente<int>* fila4 = new FilaConcorrente<int>(p, 4, 2);
+
+		double v0 = medir(travado, p, operacoes);
+		double v1 = medir(fila2, p, operacoes);
+		double v2 = medir(fila4, p, operacoes);
+
+		printf("  %2d threads: MaxHeap + mutex %6.2f  MultiQueue c = 2 %6.2f  MultiQueue c = 4 %6.2f\n",
+		       p, v0, v1, v2);
+
+		delete travado;
+		delete fila2;
+		delete fila4;
+	}
+
+	printf("Erro de posto\n");
+
+	erroDePosto(1, 1, 2, 100000);
+	erroDePosto(4, 2, 2, 100000);
+	erroDePosto(4, 2, 1, 100000);
+	erroDePosto(16, 2, 2, 100000);
+	erroDePosto(16, 4, 2, 100000);
+	erroDePosto(16, 2, 4, 100000);
+
+	return 0;
+}
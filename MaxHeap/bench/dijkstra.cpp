@@ -0,0 +1,169 @@
+//Mede o algoritmo de Dijkstra em um grafo orientado sorteado, com n
+//vértices e grau de saída g, usando duas filas de prioridade:
+//  - HeapIndexado, com um handle por vértice: cada relaxamento altera a
+//    prioridade do vértice (inserir ou atualizar) e a fila nunca tem
+//    mais de n elementos;
+//  - FilaPrioridade de pares (distância, vértice), inserindo uma cópia
+//    a cada relaxamento e descartando, na remoção, as entradas vencidas.
+//As duas devem chegar à mesma soma das distâncias.
+//
+//Compilação, a partir do diretório MaxHeap:
+//  g++ -std=c++11 -O2 -I. bench/dijkstra.cpp -o dijkstra
+//
+//Uso: dijkstra [vértices] [grau de saída]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <utility>
+#include "HeapIndexado.h"
+#include "FilaPrioridade.h"
+#include "../../Bench.h"
+
+#define INFINITO (1LL << 62)
+
+//Grafo em listas de adjacência compactas: as arestas de v são
+//destino[inicio[v]] a destino[inicio[v + 1] - 1]
+struct Grafo
+{
+	int n;
+	int* inicio;
+	int* destino;
+	int* peso;
+};
+
+static void sortear(Grafo& g, int n, int grau)
+{
+	g.n = n;
+	g.inicio = new int[n + 1];
+	g.destino = new int[(long) n * grau];
+	g.peso = new int[(long) n * grau];
+
+	semente = 11;
+
+	for (int v = 0; v <= n; v++)
+		g.inicio[v] = v * grau;
+
+	for (long e = 0; e < (long) n * grau; e++)
+	{
+		g.destino[e] = proximo() % n;
+		g.peso[e] = 1 + proximo() % 1000;
+	}
+}
+
+//Dijkstra a partir do vértice 0 com o HeapIndexado; devolve a soma das
+//distâncias dos vértices alcançados
+static long long comHandles(const Grafo& g, long long* dist, int& maiorFila)
+{
+	HeapIndexado<long long, std::greater<long long> > fila(g.n);
+
+	for (int v = 0; v < g.n; v++)
+		dist[v] = INFINITO;
+
+	dist[0] = 0;
+	fila.inserir(0, 0);
+	maiorFila = 1;
+
+	long long soma = 0;
+
+	while (!fila.vazio())
+	{
+		int u = fila.remover();
+
+		soma += dist[u];
+
+		for (int e = g.inicio[u]; e < g.inicio[u + 1]; e++)
+		{
+			int v = g.destino[e];
+			long long d = dist[u] + g.peso[e];
+
+			if (d < dist[v])
+			{
+				//Ou o vértice ainda não está na fila, ou a sua
+				//prioridade aumenta
+				if (!fila.atualizar(v, d))
+					fila.inserir(v, d);
+
+				dist[v] = d;
+			}
+		}
+
+		if (fila.tamanho() > maiorFila)
+			maiorFila = fila.tamanho();
+	}
+
+	return soma;
+}
+
+//Dijkstra a partir do vértice 0 com cópias na FilaPrioridade
+static long long comCopias(const Grafo& g, long long* dist, int& maiorFila)
+{
+	FilaPrioridade<std::pair<long long, int>, std::greater<std::pair<long long, int> > > fila;
+
+	for (int v = 0; v < g.n; v++)
+		dist[v] = INFINITO;
+
+	dist[0] = 0;
+	fila.inserir(std::make_pair(0LL, 0));
+	maiorFila = 1;
+
+	long long soma = 0;
+
+	while (!fila.vazio())
+	{
+		std::pair<long long, int> topo = fila.remover();
+		int u = topo.second;
+
+		//Entrada vencida: o vértice já saiu com uma distância menor
+		if (topo.first > dist[u])
+			continue;
+
+		soma += dist[u];
+
+		for (int e = g.inicio[u]; e < g.inicio[u + 1]; e++)
+		{
+			int v = g.destino[e];
+			long long d = dist[u] + g.peso[e];
+
+			if (d < dist[v])
+			{
+				dist[v] = d;
+				fila.inserir(std::make_pair(d, v));
+			}
+		}
+
+		if (fila.tamanho() > maiorFila)
+			maiorFila = fila.tamanho();
+	}
+
+	return soma;
+}
+
+int main(int argc, char** argv)
+{
+	int n = argc > 1 ? atoi(argv[1]) : 1000000;
+	int grau = argc > 2 ? atoi(argv[2]) : 8;
+
+	Grafo g;
+	sortear(g, n, grau);
+
+	long long* dist = new long long[n];
+	int maiorFila;
+
+	printf("%d vértices, %ld arestas\n", n, (long) n * grau);
+
+	std::chrono::steady_clock::time_point inicio = agora();
+	long long soma = comHandles(g, dist, maiorFila);
+	printf("HeapIndexado:   %8.3f s  maior fila %9d  (%lld)\n", segundos(inicio), maiorFila, soma);
+
+	inicio = agora();
+	soma = comCopias(g, dist, maiorFila);
+	printf("FilaPrioridade: %8.3f s  maior fila %9d  (%lld)\n", segundos(inicio), maiorFila, soma);
+
+	delete[] dist;
+	delete[] g.inicio;
+	delete[] g.destino;
+	delete[] g.peso;
+
+	return 0;
+}
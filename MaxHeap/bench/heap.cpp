@@ -0,0 +1,98 @@
+//Compara o MaxHeap binário recursivo com o DaryHeap para alguns
+//valores de D, com e sem o alinhamento dos grupos de irmãos à linha
+//de cache, e com a FilaPrioridade genérica, em três cargas sobre n
+//elementos:
+//  - n inserções seguidas de n remoções;
+//  - heap com n elementos e n operações, metade inserções e metade
+//    remoções, sorteadas;
+//  - heap com n elementos e n ciclos de uma remoção seguida de uma
+//    inserção (o padrão de uma fila de eventos).
+//A soma dos valores removidos deve ser a mesma para todos os heaps.
+//
+//Compilação, a partir do diretório MaxHeap:
+//  g++ -std=c++11 -O2 -I. bench/heap.cpp MaxHeap.cpp -o heap
+//
+//Uso: heap [quantidade de elementos]
+
+#include "MaxHeap.h"
+#include "DaryHeap.h"
+#include "FilaPrioridade.h"
+#include "../../Bench.h"
+
+template <class Heap>
+static void medir(const char* nome, int n)
+{
+	Heap* heap = new Heap(2 * n);
+	long long soma = 0;
+
+	//n inserções e n remoções
+	semente = 7;
+	std::chrono::steady_clock::time_point inicio = agora();
+
+	for (int i = 0; i < n; i++)
+		heap->inserir(proximo());
+
+	for (int i = 0; i < n; i++)
+		soma += heap->remover();
+
+	double ordenacao = segundos(inicio);
+
+	//Mistura sorteada de inserções e remoções
+	for (int i = 0; i < n; i++)
+		heap->inserir(proximo());
+
+	int tamanho = n;
+	inicio = agora();
+
+	for (int i = 0; i < n; i++)
+	{
+		int v = proximo();
+
+		if ((v & 1) || tamanho == 0)
+		{
+			heap->inserir(v);
+			tamanho++;
+		}
+		else
+		{
+			soma += heap->remover();
+			tamanho--;
+		}
+	}
+
+	double mistura = segundos(inicio);
+
+	//Remove o maior e insere um novo, n vezes
+	inicio = agora();
+
+	for (int i = 0; i < n; i++)
+	{
+		soma += heap->remover();
+		heap->inserir(proximo());
+	}
+
+	double eventos = segundos(inicio);
+
+	cout << nome << "\tinserir+remover: " << ordenacao << " s\tmistura: " << mistura
+	     << " s\tremover+inserir: " << eventos << " s\t(" << soma << ")" << endl;
+
+	delete heap;
+}
+
+int main(int argc, char** argv)
+{
+	int n = argc > 1 ? atoi(argv[1]) : 10000000;
+
+	cout << n << " elementos" << endl;
+
+	medir<MaxHeap>("MaxHeap         ", n);
+	medir<DaryHeap<int, 2> >("DaryHeap<2>     ", n);
+	medir<DaryHeap<int, 4> >("DaryHeap<4>     ", n);
+	medir<DaryHeap<int, 8> >("DaryHeap<8>     ", n);
+	medir<DaryHeap<int, 4, true> >("DaryHeap<4, al> ", n);
+	medir<DaryHeap<int, 8, true> >("DaryHeap<8, al> ", n);
+	medir<DaryHeap<int, 16, true> >("DaryHeap<16, al>", n);
+	medir<FilaPrioridade<int> >("FilaPrioridade<4>", n);
+
+	return 0;
+}
@@ -0,0 +1,87 @@
+//Mede, sobre n inteiros sorteados:
+//  - a construção do heap sequencial e a paralela;
+//  - o heapsort contra std::sort;
+//  - os k maiores pelo TopK, pelo ordenarParcial e pelo caminho antigo
+//    (construir o heap e chamar remover k vezes).
+//
+//Compilação, a partir do diretório MaxHeap:
+//  g++ -std=c++11 -O2 -pthread -I. bench/ordenacao.cpp -o ordenacao
+//
+//Uso: ordenacao [quantidade de elementos] [k] [threads]
+
+#include <algorithm>
+#include <chrono>
+#include "DaryHeap.h"
+#include "Ordenacao.h"
+#include "../../Bench.h"
+
+static void preencher(int* v, int n)
+{
+	semente = 3;
+
+	for (int i = 0; i < n; i++)
+		v[i] = proximo();
+}
+
+int main(int argc, char** argv)
+{
+	int n = argc > 1 ? atoi(argv[1]) : 20000000;
+	int k = argc > 2 ? atoi(argv[2]) : 1000;
+	int numThreads = argc > 3 ? atoi(argv[3]) : (int) std::thread::hardware_concurrency();
+
+	int* v = new int[n];
+	int* maiores = new int[k];
+
+	cout << n << " elementos, k = " << k << ", " << numThreads << " threads" << endl;
+
+	preencher(v, n);
+	std::chrono::steady_clock::time_point inicio = agora();
+	construirHeap(v, n);
+	cout << "construirHeap:          " << segundos(inicio) << " s" << endl;
+
+	preencher(v, n);
+	inicio = agora();
+	construirHeapParalelo(v, n, numThreads);
+	cout << "construirHeapParalelo:  " << segundos(inicio) << " s" << endl;
+
+	preencher(v, n);
+	inicio = agora();
+	heapsort(v, n);
+	cout << "heapsort:               " << segundos(inicio) << " s" << endl;
+
+	preencher(v, n);
+	inicio = agora();
+	std::sort(v, v + n);
+	cout << "std::sort:              " << segundos(inicio) << " s" << endl;
+
+	//Os k maiores, do maior para o menor
+	preencher(v, n);
+	inicio = agora();
+
+	TopK<int> topK(k);
+	for (int i = 0; i < n; i++)
+		topK.oferecer(v[i]);
+	topK.resultado(maiores);
+
+	cout << "TopK:                   " << segundos(inicio) << " s\t(" << maiores[0] << " ... " << maiores[k - 1] << ")" << endl;
+
+	inicio = agora();
+	ordenarParcial<int, std::greater<int>, 4>(v, n, k, std::greater<int>());
+	cout << "ordenarParcial:         " << segundos(inicio) << " s\t(" << v[0] << " ... " << v[k - 1] << ")" << endl;
+
+	preencher(v, n);
+	inicio = agora();
+
+	DaryHeap<int, 2>* heap = new DaryHeap<int, 2>(n);
+	heap->construirHeap(v, n);
+	for (int i = 0; i < k; i++)
+		maiores[i] = heap->remover();
+
+	cout << "construirHeap + remover: " << segundos(inicio) << " s\t(" << maiores[0] << " ... " << maiores[k - 1] << ")" << endl;
+
+	delete heap;
+	delete[] v;
+	delete[] maiores;
+
+	return 0;
+}
@@ -0,0 +1,165 @@
+#ifndef NODEPOOL_H
+#define NODEPOOL_H
+
+#include <stddef.h>
+#include <new>
+#include <utility>
+
+//Alocador de nós de árvore usado pela BinaryTree, pela AvlTree e
+//pela RBTree. Os nós são tirados de blocos (slabs) de tamanho
+//crescente, até MAX_SLAB nós por bloco; um nó liberado vai para uma
+//lista livre e é reaproveitado pela próxima alocação. Alocar e
+//liberar custam O(1), sem chamar malloc a cada nó.
+//
+//Cada árvore tem o seu próprio pool, então não há travas. Ao
+//destruir o pool (junto com a árvore) os blocos são devolvidos de
+//uma só vez, sem percorrer a árvore; por isso os destrutores dos nós
+//que ainda estão em uso não são chamados, e T não deve depender
+//deles.
+
+#define FIRST_SLAB 64
+#define MAX_SLAB   65536
+
+template <class T>
+class NodePool
+{
+    private:
+        //Espaço de um nó. Enquanto livre, guarda o próximo da lista
+        union Slot
+        {
+            Slot* next;
+            alignas(T) char data[sizeof(T)];
+        };
+
+        Slot* freeList;  //nós liberados
+        Slot* slabs;     //blocos alocados; slot 0 de cada um liga ao anterior
+        Slot* cursor;    //próximo nó nunca usado do bloco atual
+        Slot* end;
+        int nextSlab;    //quantidade de nós do próximo bloco
+        int live;        //nós em uso
+        long bytes;      //memória de todos os blocos
+
+        //Não copiável
+        NodePool(const NodePool&);
+        NodePool& operator=(const NodePool&);
+
+        void newSlab()
+        {
+            Slot* block = static_cast<Slot*>(::operator new(sizeof(Slot) * (size_t) (nextSlab + 1)));
+
+            block[0].next = slabs;
+            slabs = block;
+
+            bytes += (long) sizeof(Slot) * (nextSlab + 1);
+
+            cursor = block + 1;
+            end = block + 1 + nextSlab;
+
+            if (nextSlab < MAX_SLAB)
+                nextSlab *= 2;
+        }
+
+    public:
+        NodePool()
+        {
+            freeList = 0;
+            slabs = 0;
+            cursor = end = 0;
+            nextSlab = FIRST_SLAB;
+            live = 0;
+            bytes = 0;
+        }
+
+        ~NodePool()
+        {
+            clear();
+        }
+
+        //Memória para um nó, ainda não construído
+        void* allocate()
+        {
+            Slot* slot;
+
+            if (freeList != 0)
+            {
+                slot = freeList;
+                freeList = slot->next;
+            }
+            else
+            {
+                if (cursor == end)
+                    newSlab();
+
+                slot = cursor++;
+            }
+
+            live++;
+
+            return slot;
+        }
+
+        //Aloca e constrói um nó com os argumentos do construtor de T
+        template <class... Args>
+        T* create(Args&&... args)
+        {
+            return new (allocate()) T(std::forward<Args>(args)...);
+        }
+
+        //Destrói o nó e devolve o seu espaço para a lista livre
+        void release(T* node)
+        {
+            node->~T();
+
+            Slot* slot = reinterpret_cast<Slot*>(node);
+
+            slot->next = freeList;
+            freeList = slot;
+
+            live--;
+        }
+
+        //Devolve todos os blocos de uma vez; os nós em uso deixam de
+        //existir
+        void clear()
+        {
+            while (slabs != 0)
+            {
+                Slot* previous = slabs[0].next;
+
+                ::operator delete(slabs);
+                slabs = previous;
+            }
+
+            freeList = 0;
+            cursor = end = 0;
+            nextSlab = FIRST_SLAB;
+            live = 0;
+            bytes = 0;
+        }
+
+        int size()
+        {
+            return live;
+        }
+
+        //Bytes obtidos do sistema para os blocos, incluindo os nós
+        //livres e os ainda não usados
+        long memoryUsage() const
+        {
+            return bytes;
+        }
+
+        //Troca o conteúdo com outro pool; os nós continuam onde estão
+        void swap(NodePool& other)
+        {
+            std::swap(freeList, other.freeList);
+            std::swap(slabs, other.slabs);
+            std::swap(cursor, other.cursor);
+            std::swap(end, other.end);
+            std::swap(nextSlab, other.nextSlab);
+            std::swap(live, other.live);
+            std::swap(bytes, other.bytes);
+        }
+};
+
+#endif
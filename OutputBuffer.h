@@ -0,0 +1,98 @@
+#ifndef OUTPUTBUFFER_H
+#define OUTPUTBUFFER_H
+
+#include <stdio.h>
+
+//Saída com buffer próprio para os percursos das árvores: os números
+//são convertidos à mão e o texto só vai para o FILE em blocos de
+//OUTPUT_BUFFER_SIZE bytes, com um fwrite por bloco, em vez de uma
+//chamada de printf ou de cout por valor. O que estiver no buffer é
+//escrito no flush ou na destruição; como tudo passa pelo mesmo FILE,
+//a ordem em relação a printf e a cout (sincronizado com stdio, o
+//padrão) é mantida.
+
+#define OUTPUT_BUFFER_SIZE 65536
+
+class OutputBuffer
+{
+    private:
+        FILE* out;
+        char* buffer;
+        int used;
+
+        //Não copiável
+        OutputBuffer(const OutputBuffer&);
+        OutputBuffer& operator=(const OutputBuffer&);
+
+        //Garante espaço para n bytes
+        void reserve(int n)
+        {
+            if (used + n > OUTPUT_BUFFER_SIZE)
+                flush();
+        }
+
+    public:
+        OutputBuffer(FILE* out = stdout)
+        {
+            this->out = out;
+            buffer = new char[OUTPUT_BUFFER_SIZE];
+            used = 0;
+        }
+
+        ~OutputBuffer()
+        {
+            flush();
+            delete[] buffer;
+        }
+
+        void flush()
+        {
+            if (used > 0)
+                fwrite(buffer, 1, used, out);
+
+            used = 0;
+        }
+
+        void write(char c)
+        {
+            reserve(1);
+            buffer[used++] = c;
+        }
+
+        void write(const char* s)
+        {
+            for (; *s != '\0'; s++)
+                write(*s);
+        }
+
+        void write(int value)
+        {
+            char digits[12];
+            int n = 0;
+
+            //Em unsigned, para que -2^31 também funcione
+            unsigned int u = value < 0 ? 0u - (unsigned int) value : (unsigned int) value;
+
+            do
+            {
+                digits[n++] = (char) ('0' + u % 10);
+                u /= 10;
+            } while (u != 0);
+
+            reserve(n + 1);
+
+            if (value < 0)
+                buffer[used++] = '-';
+
+            while (n > 0)
+                buffer[used++] = digits[--n];
+        }
+
+        void spaces(int n)
+        {
+            for (int i = 0; i < n; i++)
+                write(' ');
+        }
+};
+
+#endif
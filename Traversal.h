@@ -0,0 +1,227 @@
+#ifndef TRAVERSAL_H
+#define TRAVERSAL_H
+
+//Percursos sem recursão para as árvores binárias do repositório
+//(BinaryTree, AvlTree e RBTree). Os nós só precisam dos campos left e
+//right; nil é o valor que indica a falta de filho (0, ou o sentinela
+//da RBTree).
+//
+//Nos percursos com pilha explícita, cada nó é entregue ao visitante
+//como visit(node, depth), com a raiz na profundidade 0. A pilha começa
+//com TRAVERSAL_STACK posições e cresce quando necessário, então uma
+//árvore degenerada não estoura a pilha de chamadas. traverseMorris
+//não usa pilha.
+
+#define TRAVERSAL_STACK 64
+
+template <class NodeT>
+class TraversalStack
+{
+    private:
+        struct Entry
+        {
+            NodeT* node;
+            int depth;
+        };
+
+        Entry initial[TRAVERSAL_STACK];
+        Entry* entries;
+        int capacity;
+        int top;
+
+        //Não copiável
+        TraversalStack(const TraversalStack&);
+        TraversalStack& operator=(const TraversalStack&);
+
+    public:
+        TraversalStack()
+        {
+            entries = initial;
+            capacity = TRAVERSAL_STACK;
+            top = 0;
+        }
+
+        ~TraversalStack()
+        {
+            if (entries != initial)
+                delete[] entries;
+        }
+
+        bool isEmpty() const
+        {
+            return top == 0;
+        }
+
+        void push(NodeT* node, int depth)
+        {
+            if (top == capacity)
+            {
+                Entry* bigger = new Entry[2 * capacity];
+
+                for (int i = 0; i < top; i++)
+                    bigger[i] = entries[i];
+
+                if (entries != initial)
+                    delete[] entries;
+
+                entries = bigger;
+                capacity *= 2;
+            }
+
+            entries[top].node = node;
+            entries[top].depth = depth;
+            top++;
+        }
+
+        NodeT* topNode() const
+        {
+            return entries[top - 1].node;
+        }
+
+        int topDepth() const
+        {
+            return entries[top - 1].depth;
+        }
+
+        void pop()
+        {
+            top--;
+        }
+};
+
+//Pré-ordem. Com withEmpty, os filhos ausentes também são visitados,
+//como nil, e uma árvore vazia visita apenas a raiz nil
+template <class NodeT, class Visitor>
+void traversePreOrder(NodeT* root, NodeT* nil, Visitor visit, bool withEmpty = false)
+{
+    TraversalStack<NodeT> stack;
+
+    if (root != nil || withEmpty)
+        stack.push(root, 0);
+
+    while (!stack.isEmpty())
+    {
+        NodeT* node = stack.topNode();
+        int depth = stack.topDepth();
+
+        stack.pop();
+        visit(node, depth);
+
+        if (node == nil)
+            continue;
+
+        //A direita entra antes para sair depois
+        if (node->right != nil || withEmpty)
+            stack.push(node->right, depth + 1);
+
+        if (node->left != nil || withEmpty)
+            stack.push(node->left, depth + 1);
+    }
+}
+
+//Ordem simétrica
+template <class NodeT, class Visitor>
+void traverseInOrder(NodeT* root, NodeT* nil, Visitor visit)
+{
+    TraversalStack<NodeT> stack;
+    NodeT* node = root;
+    int depth = 0;
+
+    while (node != nil || !stack.isEmpty())
+    {
+        //Desce pela esquerda empilhando o caminho
+        while (node != nil)
+        {
+            stack.push(node, depth++);
+            node = node->left;
+        }
+
+        node = stack.topNode();
+        depth = stack.topDepth();
+        stack.pop();
+
+        visit(node, depth);
+
+        node = node->right;
+        depth++;
+    }
+}
+
+//Pós-ordem: um nó do topo da pilha só é visitado depois da sua
+//subárvore direita, reconhecida por ter sido o último nó visitado
+template <class NodeT, class Visitor>
+void traversePosOrder(NodeT* root, NodeT* nil, Visitor visit)
+{
+    TraversalStack<NodeT> stack;
+    NodeT* node = root;
+    NodeT* last = nil;
+    int depth = 0;
+
+    while (node != nil || !stack.isEmpty())
+    {
+        if (node != nil)
+        {
+            stack.push(node, depth++);
+            node = node->left;
+            continue;
+        }
+
+        NodeT* top = stack.topNode();
+
+        if (top->right != nil && top->right != last)
+        {
+            node = top->right;
+            depth = stack.topDepth() + 1;
+        }
+        else
+        {
+            visit(top, stack.topDepth());
+            last = top;
+            stack.pop();
+        }
+    }
+}
+
+//Ordem simétrica pelo percurso de Morris, sem pilha: cada nó com
+//subárvore esquerda é alcançado de volta por um fio temporário no
+//ponteiro right do seu predecessor, desfeito na segunda passagem. A
+//memória extra é O(1) mesmo em uma árvore degenerada, mas a
+//profundidade não é conhecida, então o nó é entregue como visit(node).
+//O visitante não deve alterar left nem right; ao terminar, a árvore
+//volta a ser a original
+template <class NodeT, class Visitor>
+void traverseMorris(NodeT* root, NodeT* nil, Visitor visit)
+{
+    NodeT* node = root;
+
+    while (node != nil)
+    {
+        if (node->left == nil)
+        {
+            visit(node);
+            node = node->right;
+            continue;
+        }
+
+        NodeT* pre = node->left;
+
+        while (pre->right != nil && pre->right != node)
+            pre = pre->right;
+
+        if (pre->right == nil)
+        {
+            //Primeira passagem: cria o fio e desce pela esquerda
+            pre->right = node;
+            node = node->left;
+        }
+        else
+        {
+            //Segunda passagem: a esquerda acabou; desfaz o fio
+            pre->right = nil;
+            visit(node);
+            node = node->right;
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,127 @@
+#ifndef TREESNAPSHOT_H
+#define TREESNAPSHOT_H
+
+#include <stdio.h>
+
+//Formato das fotografias da AvlTree e da RBTree (saveSnapshot e
+//loadSnapshot), o mesmo para as duas:
+//
+//  cabeçalho: magic, quantidade de valores
+//  os valores, em ordem crescente
+//
+//A forma da árvore não é gravada: a carga monta, em O(n) e sem
+//rotações, a árvore perfeitamente balanceada sobre os valores em
+//ordem, e dessa forma saem os fatores de balanceamento da AVL e as
+//cores da rubro-negra. Por isso uma fotografia de uma das árvores
+//também pode ser carregada na outra.
+//
+//SnapshotWriter e SnapshotReader leem e escrevem os inteiros em blocos
+//de SNAPSHOT_BLOCK, sem montar a árvore inteira em memória.
+
+#define TREE_SNAPSHOT_MAGIC  0x54534e50
+#define TREE_SNAPSHOT_HEADER 2
+#define SNAPSHOT_BLOCK       16384
+
+class SnapshotWriter
+{
+    private:
+        FILE* out;
+        int* block;
+        int used;
+        bool ok;
+
+        //Não copiável
+        SnapshotWriter(const SnapshotWriter&);
+        SnapshotWriter& operator=(const SnapshotWriter&);
+
+        void flush()
+        {
+            if (used > 0 && fwrite(block, sizeof(int), used, out) != (size_t) used)
+                ok = false;
+
+            used = 0;
+        }
+
+    public:
+        SnapshotWriter(FILE* out)
+        {
+            this->out = out;
+            block = new int[SNAPSHOT_BLOCK];
+            used = 0;
+            ok = true;
+        }
+
+        ~SnapshotWriter()
+        {
+            delete[] block;
+        }
+
+        void write(int value)
+        {
+            if (used == SNAPSHOT_BLOCK)
+                flush();
+
+            block[used++] = value;
+        }
+
+        //Grava o que falta; false se alguma escrita falhou
+        bool finish()
+        {
+            flush();
+
+            return ok;
+        }
+};
+
+class SnapshotReader
+{
+    private:
+        FILE* in;
+        int* block;
+        int used;
+        int available;
+        bool ok;
+
+        //Não copiável
+        SnapshotReader(const SnapshotReader&);
+        SnapshotReader& operator=(const SnapshotReader&);
+
+    public:
+        SnapshotReader(FILE* in)
+        {
+            this->in = in;
+            block = new int[SNAPSHOT_BLOCK];
+            used = available = 0;
+            ok = true;
+        }
+
+        ~SnapshotReader()
+        {
+            delete[] block;
+        }
+
+        //Próximo inteiro do arquivo; 0 depois do fim, com failed()
+        int read()
+        {
+            if (used == available)
+            {
+                used = 0;
+                available = (int) fread(block, sizeof(int), SNAPSHOT_BLOCK, in);
+
+                if (available == 0)
+                {
+                    ok = false;
+                    return 0;
+                }
+            }
+
+            return block[used++];
+        }
+
+        bool failed() const
+        {
+            return !ok;
+        }
+};
+
+#endif
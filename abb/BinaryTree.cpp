@@ -0,0 +1,376 @@
+#include <math.h>
+#include "BinaryTree.h"
+#include "../OutputBuffer.h"
+
+void BinaryTree::preOrder(Node* node)
+{
+	OutputBuffer out;
+
+	traversePreOrder(node, (Node*) 0, [&](Node* n, int) {
+		out.write(n->info);
+		out.write(' ');
+	});
+}
+
+void BinaryTree::inOrder(Node* node)
+{
+	OutputBuffer out;
+
+	traverseInOrder(node, (Node*) 0, [&](Node* n, int) {
+		out.write(n->info);
+		out.write(' ');
+	});
+}
+
+void BinaryTree::posOrder(Node* node)
+{
+	OutputBuffer out;
+
+	traversePosOrder(node, (Node*) 0, [&](Node* n, int) {
+		out.write(n->info);
+		out.write(' ');
+	});
+}
+
+void BinaryTree::visit(Node* node)
+{
+	cout << node->info << " ";
+}
+
+void BinaryTree::posOrderHeight(Node* node)
+{
+	if (node)
+	{
+		posOrderHeight(node->left);
+		posOrderHeight(node->right);
+		heightNode(node);
+	}
+}
+
+void BinaryTree::heightNode(Node* node)
+{
+	int alt1, alt2;
+
+	if (node->left)
+		alt1 = node->left->height;
+	else
+		alt1 = 0;
+
+	if (node->right)
+		alt2 = node->right->height;
+	else
+		alt2 = 0;
+
+	if (alt1 > alt2)
+		node->height = alt1 + 1;
+	else
+		node->height = alt2 + 1;	
+}
+
+Node* BinaryTree::findNode(int value, Node*& parent)
+{
+	Node* cur = root;
+
+	while (cur)
+	{
+		if (cur->info == value)
+			return cur;
+
+		//Não achei, tenho que descer na árvore
+		parent = cur;
+		if (value < cur->info)
+			cur = cur->left;
+		else
+			cur = cur->right;
+	}
+
+	return cur;
+}
+
+//Desce guardando o caminho, para depois acertar as alturas dos
+//ancestrais e, se o novo nó ficou fundo demais, procurar o bode
+//expiatório entre eles
+bool BinaryTree::addNode(int value)
+{
+	Node* cur = root;
+	int depth = 0;
+
+	while (cur)
+	{
+		if (cur->info == value)
+			return false;
+
+		pushPath(cur, depth++);
+
+		if (value < cur->info)
+			cur = cur->left;
+		else
+			cur = cur->right;
+	}
+
+	doAddNode(value, depth > 0 ? path[depth - 1] : 0);
+	updateHeights(depth);
+
+	int n = pool.size();
+
+	if (n > maxSize)
+		maxSize = n;
+
+	if (!balancing || depth <= (int) (log((double) n) / log(1.0 / SCAPEGOAT_ALPHA)))
+		return true;
+
+	//Sobe do novo nó até um ancestral desbalanceado
+	Node* child = depth > 0 ? (value < path[depth - 1]->info ? path[depth - 1]->left : path[depth - 1]->right) : root;
+	int childSize = 1;
+
+	for (int i = depth - 1; i >= 0; i--)
+	{
+		Node* node = path[i];
+		Node* sibling = child == node->left ? node->right : node->left;
+		int nodeSize = childSize + subtreeSize(sibling) + 1;
+
+		if (childSize > SCAPEGOAT_ALPHA * nodeSize)
+		{
+			Node* subtree = rebuild(node, nodeSize);
+
+			if (i == 0)
+				root = subtree;
+			else if (path[i - 1]->left == node)
+				path[i - 1]->left = subtree;
+			else
+				path[i - 1]->right = subtree;
+
+			updateHeights(i);
+			break;
+		}
+
+		child = node;
+		childSize = nodeSize;
+	}
+
+	return true;
+}
+
+void BinaryTree::doAddNode(int value, Node* parent)
+{
+	if (parent)
+	{
+		if (value < parent->info)
+			parent->left = pool.create(value);
+		else
+			parent->right = pool.create(value);
+	}
+	else
+		root = pool.create(value);
+}
+
+bool BinaryTree::removeNode(int value)
+{
+	Node* node = root;
+	int depth = 0;
+
+	while (node && node->info != value)
+	{
+		pushPath(node, depth++);
+
+		if (value < node->info)
+			node = node->left;
+		else
+			node = node->right;
+	}
+
+	if (!node)
+		return false;
+
+	Node* parent = depth > 0 ? path[depth - 1] : 0;
+
+	//O caminho até o pai do nó que doRemoveNode vai retirar de fato
+	if (node->left && node->right)
+	{
+		pushPath(node, depth++);
+
+		for (Node* y = node->right; y->left; y = y->left)
+			pushPath(y, depth++);
+	}
+
+	doRemoveNode(node, parent);
+	updateHeights(depth);
+
+	//Depois de muitas remoções a árvore inteira é reconstruída
+	if (balancing && pool.size() < SCAPEGOAT_ALPHA * maxSize)
+		rebalance();
+
+	return true;
+}
+
+void BinaryTree::doRemoveNode(Node* node, Node* parent)
+{
+	Node* y;
+	Node* py;
+	Node* x;
+
+	if (!node->left || !node->right)
+	{
+		//Tem 0 ou 1 filho
+		y = node;
+		py = parent;
+	}
+	else
+	{//Tem dois filhos, preciso encontrar o menor valor da subárvore da direita
+		py = node;
+		y = node->right;
+
+		while (y->left)
+		{
+			py = y;
+			y = y->left;
+		}
+	}
+
+	//Vou fazer x apontar para o único filho de y, se existir
+	if (y->left)
+		x = y->left;
+	else
+		x = y->right;
+
+
+	//Removo o y
+	if (py)
+	{
+		if (y == py->left)
+			py->left = x;
+		else
+			py->right = x;
+	}
+	else//Estou removendo a raiz
+		root = x;
+
+	if (y != node)
+		node->info = y->info;
+
+	pool.release(y);
+}
+
+void BinaryTree::setBalancing(bool on)
+{
+	balancing = on;
+	maxSize = pool.size();
+}
+
+//Reconstrói a árvore inteira perfeitamente balanceada, em O(n)
+void BinaryTree::rebalance()
+{
+	root = rebuild(root, pool.size());
+	maxSize = pool.size();
+}
+
+int BinaryTree::size()
+{
+	return pool.size();
+}
+
+int BinaryTree::height()
+{
+	return root ? root->height : 0;
+}
+
+void BinaryTree::pushPath(Node* node, int depth)
+{
+	if (depth == pathCapacity)
+	{
+		int capacity = pathCapacity > 0 ? 2 * pathCapacity : 64;
+		Node** bigger = new Node*[capacity];
+
+		for (int i = 0; i < depth; i++)
+			bigger[i] = path[i];
+
+		delete[] path;
+		path = bigger;
+		pathCapacity = capacity;
+	}
+
+	path[depth] = node;
+}
+
+//Recalcula as alturas de path[depth - 1] até a raiz, parando no
+//primeiro nó cuja altura não mudou
+void BinaryTree::updateHeights(int depth)
+{
+	for (int i = depth - 1; i >= 0; i--)
+	{
+		int old = path[i]->height;
+
+		heightNode(path[i]);
+
+		if (path[i]->height == old)
+			break;
+	}
+}
+
+//Conta os nós da subárvore pelo percurso de Morris, sem pilha nem
+//recursão: a subárvore pode ser muito funda se o balanceamento esteve
+//desligado
+int BinaryTree::subtreeSize(Node* node)
+{
+	int n = 0;
+
+	traverseMorris(node, (Node*) 0, [&](Node*) {
+		n++;
+	});
+
+	return n;
+}
+
+//Os valores são lidos em ordem (por Morris) para um vetor temporário
+FrozenTree* BinaryTree::freeze()
+{
+	int n = pool.size();
+	int* values = new int[n > 0 ? n : 1];
+	int i = 0;
+
+	traverseMorris(root, (Node*) 0, [&](Node* node) {
+		values[i++] = node->info;
+	});
+
+	FrozenTree* frozen = new FrozenTree(values, n);
+
+	delete[] values;
+
+	return frozen;
+}
+
+//Reconstrói balanceada a subárvore de node, que tem size nós: guarda
+//os nós em ordem (também por Morris) e os religa a partir do meio
+Node* BinaryTree::rebuild(Node* node, int size)
+{
+	if (size == 0)
+		return 0;
+
+	Node** nodes = new Node*[size];
+	int n = 0;
+
+	traverseMorris(node, (Node*) 0, [&](Node* visited) {
+		nodes[n++] = visited;
+	});
+
+	Node* subtree = build(nodes, 0, n - 1);
+
+	delete[] nodes;
+
+	return subtree;
+}
+
+Node* BinaryTree::build(Node** nodes, int lo, int hi)
+{
+	if (lo > hi)
+		return 0;
+
+	int mid = lo + (hi - lo) / 2;
+	Node* node = nodes[mid];
+
+	node->left = build(nodes, lo, mid - 1);
+	node->right = build(nodes, mid + 1, hi);
+	heightNode(node);
+
+	return node;
+}
@@ -0,0 +1,97 @@
+#include "node.h"
+#include "../NodePool.h"
+#include "../FrozenTree.h"
+#include "../Traversal.h"
+#include <iostream>
+
+using namespace std;
+
+//Fator do balanceamento por bode expiatório (scapegoat): uma inserção
+//mais funda que log(n) na base 1 / ALPHA reconstrói a subárvore de um
+//ancestral em que um filho tem mais que ALPHA dos nós
+#define SCAPEGOAT_ALPHA 0.7
+
+class BinaryTree
+{
+	public:
+		Node* root;
+		NodePool<Node> pool; //todos os nós; liberados junto com a árvore
+
+		//Construtor
+		BinaryTree()
+		{
+			root = 0;
+			maxSize = 0;
+			balancing = true;
+			path = 0;
+			pathCapacity = 0;
+		}
+
+		~BinaryTree()
+		{
+			delete[] path;
+		}
+
+		//Percursos, que imprimem os valores por um OutputBuffer
+		void preOrder(Node*);
+		void inOrder(Node*);
+		void posOrder(Node*);
+
+		//Percursos sem recursão, que chamam visit(node, depth)
+		template <class Visitor>
+		void visitPreOrder(Visitor visit)
+		{
+			traversePreOrder(root, (Node*) 0, visit);
+		}
+
+		template <class Visitor>
+		void visitInOrder(Visitor visit)
+		{
+			traverseInOrder(root, (Node*) 0, visit);
+		}
+
+		template <class Visitor>
+		void visitPosOrder(Visitor visit)
+		{
+			traversePosOrder(root, (Node*) 0, visit);
+		}
+
+
+		//Visita
+		void visit(Node*);
+
+		//Cálculo da altura
+		void posOrderHeight(Node*);
+		void heightNode(Node*);
+
+		Node* findNode(int, Node*&);
+
+		bool addNode(int);
+		void doAddNode(int, Node*);
+
+		bool removeNode(int);
+		void doRemoveNode(Node*, Node*);
+
+		//Balanceamento. Ligado por padrão; desligado, a árvore volta a
+		//ser uma ABB comum, que pode ser balanceada de uma vez com
+		//rebalance(). As alturas dos nós ficam sempre atualizadas
+		void setBalancing(bool);
+		void rebalance();
+		int size();
+		int height();
+
+		//Cópia somente leitura para consultas rápidas; quem chama a libera
+		FrozenTree* freeze();
+
+	private:
+		int maxSize;     //maior tamanho desde a última reconstrução total
+		bool balancing;
+		Node** path;     //ancestrais do nó inserido ou removido
+		int pathCapacity;
+
+		void pushPath(Node*, int);
+		void updateHeights(int);
+		int subtreeSize(Node*);
+		Node* rebuild(Node*, int);
+		Node* build(Node**, int, int);
+};
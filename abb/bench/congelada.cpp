@@ -0,0 +1,64 @@
+//Compara BinaryTree::findNode com FrozenTree::contains (a cópia obtida
+//com freeze) para árvores de 1K até o tamanho máximo pedido, de 10 em
+//10 vezes, com o mesmo conjunto de consultas sorteadas (cerca de
+//metade encontradas).
+//
+//Compilação, a partir do diretório abb:
+//  g++ -std=c++11 -O2 -I. bench/congelada.cpp BinaryTree.cpp -o congelada
+//
+//Uso: congelada [tamanho máximo] [consultas]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include "BinaryTree.h"
+#include "../../Bench.h"
+
+int main(int argc, char** argv)
+{
+    int maximo = argc > 1 ? atoi(argv[1]) : 10000000;
+    int q = argc > 2 ? atoi(argv[2]) : 5000000;
+    int* consultas = new int[q];
+
+    printf("%12s %14s %14s\n", "chaves", "findNode ns", "congelada ns");
+
+    for (int n = 1000; n <= maximo; n *= 10)
+    {
+        //Chaves pares; as consultas, pares ou ímpares, caem no mesmo intervalo
+        BinaryTree* tree = new BinaryTree();
+
+        semente = 7;
+        for (int i = 0; i < n; i++)
+            tree->addNode((proximo() % n) * 2);
+
+        for (int i = 0; i < q; i++)
+            consultas[i] = proximo() % (2 * n);
+
+        FrozenTree* frozen = tree->freeze();
+        int achados = 0;
+
+        std::chrono::steady_clock::time_point inicio = agora();
+        for (int i = 0; i < q; i++)
+        {
+            Node* parent = 0;
+
+            achados += tree->findNode(consultas[i], parent) != 0;
+        }
+        double arvore = segundos(inicio);
+
+        inicio = agora();
+        for (int i = 0; i < q; i++)
+            achados -= frozen->contains(consultas[i]);
+        double congelada = segundos(inicio);
+
+        printf("%12d %14.1f %14.1f%s\n", n, arvore * 1e9 / q, congelada * 1e9 / q,
+               achados == 0 ? "" : "  (resultados diferentes!)");
+
+        delete frozen;
+        delete tree;
+    }
+
+    delete[] consultas;
+
+    return 0;
+}
@@ -0,0 +1,16 @@
+class Node
+{
+	public:
+		int info;
+		int height;
+		Node* left;
+		Node* right;
+
+		//Construtor
+		Node(int value)
+		{
+			info = value;
+			height = 1;
+			left = right = 0;
+		}
+};
\ No newline at end of file
@@ -0,0 +1,786 @@
+#include <stdio.h>
+#include "AvlTree.h"
+#include "../OutputBuffer.h"
+#include <math.h>
+#include <limits.h>
+
+Node::Node(int value)
+{
+    info = value;
+    left = right = 0;
+    balance = 0;
+    count = 1;
+}
+
+AvlTree::AvlTree()
+{
+    root = 0;
+    numberOfNodes = 0;
+}
+
+//Os nós são liberados de uma vez com o pool
+AvlTree::~AvlTree()
+{
+    numberOfNodes = 0;
+    root = 0;
+}
+
+int 
+AvlTree::size()
+{
+    return numberOfNodes;
+}
+
+bool 
+AvlTree::isEmpty()
+{
+    return numberOfNodes == 0;
+}
+
+void 
+AvlTree::printPre()
+{
+    printPre(root);
+}
+
+void 
+AvlTree::printOrder()
+{
+    printOrder(root);
+}
+
+void 
+AvlTree::printPos()
+{
+    printPos(root);
+}
+
+Node* 
+AvlTree::getRoot ()
+{
+    return root;
+}
+
+//Pré-ordem com os filhos ausentes, indentada pela profundidade
+void AvlTree::printAscii(Node* node)
+{
+    OutputBuffer out;
+
+    traversePreOrder(node, (Node*) 0, [&](Node* n, int depth) {
+        out.spaces(3 * depth);
+
+        if (n == 0)
+        {
+            out.write("-\n");
+            return;
+        }
+
+        out.write(n->info);
+        out.write(' ');
+        out.write((int) n->balance);
+        out.write('\n');
+    }, true);
+}
+
+//Retorna false se a chave já estiver na árvore ou se a árvore já
+//tiver AVL_MAX_NODES nós
+bool AvlTree::insert(int info)
+{
+    if (numberOfNodes >= AVL_MAX_NODES)
+        return false;
+
+    Node** path[AVL_MAX_HEIGHT];
+    bool wentRight[AVL_MAX_HEIGHT];
+    int depth = 0;
+    Node** link = &root;
+
+    while (*link != 0)
+    {
+        Node* cur = *link;
+
+        if (cur->info == info)
+            return false;
+
+        path[depth] = link;
+        wentRight[depth] = cur->info < info;
+        link = wentRight[depth] ? &cur->right : &cur->left;
+        depth++;
+    }
+
+    *link = pool.create(info);
+    numberOfNodes++;
+
+    for (int i = 0; i < depth; i++)
+        (*path[i])->count++;
+
+    while (depth > 0)
+    {
+        depth--;
+        Node*& ptr = *path[depth];
+
+        if (!wentRight[depth])
+        {
+            switch(ptr->balance)
+            {
+                case 1:
+                    ptr->balance = 0;
+                    return true;
+                case 0:
+                    ptr->balance = -1;
+                    break;
+                case -1:
+                    rightRotation(ptr);
+                    return true;
+            }
+        }
+        else
+        {
+            switch(ptr->balance)
+            {
+                case -1:
+                    ptr->balance = 0;
+                    return true;
+                case 0:
+                    ptr->balance = 1;
+                    break;
+                case 1:
+                    leftRotation(ptr);
+                    return true;
+            }
+        }
+    }
+
+    return true;
+}
+
+void AvlTree::rightRotation(Node*& pt)
+{
+    Node* ptu = pt->left;
+
+    if (ptu->balance == -1)
+    {
+		//Rotação à direita
+        pt->left = ptu->right;
+        ptu->right = pt;
+        pt->balance = 0;
+        updateCount(pt);
+        pt = ptu;
+    }
+    else
+    {
+		//Rotação dupla à direita
+        //Primeira parte
+        Node* ptv = ptu->right;
+        
+        ptu->right = ptv->left;
+        ptv->left = ptu;
+        //Segunda parte
+        pt->left = ptv->right;
+        ptv->right = pt;
+
+        if (ptv->balance == -1)
+            pt->balance = 1;
+        else
+            pt->balance = 0;
+
+        if (ptv->balance == 1)
+            ptu->balance = -1;
+        else
+            ptu->balance = 0;
+
+        updateCount(pt);
+        updateCount(ptu);
+        pt = ptv;
+    }
+
+    pt->balance = 0;
+    updateCount(pt);
+}
+
+void AvlTree::leftRotation(Node*& pt)
+{
+    Node* ptu = pt->right;
+
+    if (ptu->balance == 1)
+    {
+		//Rotação à esquerda
+        pt->right = ptu->left;
+        ptu->left = pt;
+        pt->balance = 0;
+        updateCount(pt);
+        pt = ptu;
+    }
+    else
+    {
+		//Rotação dupla à esquerda
+		//Primeira parte
+        Node* ptv = ptu->left;
+        ptu->left = ptv->right;
+        ptv->right = ptu;
+        //Segunda parte
+        pt->right = ptv->left;
+        ptv->left = pt;
+
+        if (ptv->balance == 1)
+            pt->balance = -1;
+        else
+            pt->balance = 0;
+
+        if (ptv->balance == -1)
+            ptu->balance = 1;
+        else
+            ptu->balance = 0;
+
+        updateCount(pt);
+        updateCount(ptu);
+        pt = ptv;
+    }
+
+    pt->balance = 0;
+    updateCount(pt);
+}
+
+//Remoção iterativa, com o mesmo caminho guardado da inserção. Um nó
+//com dois filhos recebe o valor do antecessor, e o nó removido de fato
+//é o antecessor, no fim do mesmo caminho. Depois sobe corrigindo os
+//fatores de balanceamento enquanto a altura continuar diminuindo
+bool AvlTree::remove(int info)
+{
+    Node** path[AVL_MAX_HEIGHT];
+    bool wentRight[AVL_MAX_HEIGHT];
+    int depth = 0;
+    Node** link = &root;
+
+    while (*link != 0 && (*link)->info != info)
+    {
+        Node* cur = *link;
+
+        path[depth] = link;
+        wentRight[depth] = cur->info < info;
+        link = wentRight[depth] ? &cur->right : &cur->left;
+        depth++;
+    }
+
+    if (*link == 0)
+        return false;
+
+    Node* aux = *link;
+
+    if (aux->left != 0 && aux->right != 0)
+    {
+        //Dois filhos, substitui pelo antecessor
+        Node* found = aux;
+
+        path[depth] = link;
+        wentRight[depth] = false;
+        link = &aux->left;
+        depth++;
+
+        while ((*link)->right != 0)
+        {
+            path[depth] = link;
+            wentRight[depth] = true;
+            link = &(*link)->right;
+            depth++;
+        }
+
+        aux = *link;
+        found->info = aux->info;
+    }
+
+    //Zero ou um filho
+    if (aux->right)
+        *link = aux->right;
+    else
+        *link = aux->left;
+
+    numberOfNodes--;
+    pool.release(aux);
+
+    for (int i = 0; i < depth; i++)
+        (*path[i])->count--;
+
+    bool h = true;
+
+    while (h && depth > 0)
+    {
+        depth--;
+        Node*& ptr = *path[depth];
+
+        if (wentRight[depth])
+        {
+            switch(ptr->balance)
+            {
+                case 1:
+                    ptr->balance = 0;
+                    break;
+                case 0:
+                    ptr->balance = -1;
+                    h = false;
+                    break;
+                case -1:
+                    removeRightRotation(ptr, h);
+            }
+        }
+        else
+        {
+            switch(ptr->balance)
+            {
+                case -1:
+                    ptr->balance = 0;
+                    break;
+                case 0:
+                    ptr->balance = 1;
+                    h = false;
+                    break;
+                case 1:
+                    removeLeftRotation(ptr, h);
+            }
+        }
+    }
+
+    return true;
+}
+
+void AvlTree::removeLeftRotation(Node*& ptr, bool& h)
+{
+	Node* ptrz = ptr->right;
+
+	if(ptrz->balance >= 0)
+    {
+		//Rotação esquerda
+		ptr->right = ptrz->left;
+		ptrz->left = ptr;
+
+		if(ptrz->balance == 0)
+        {
+			ptr->balance = 1;
+			ptrz->balance = -1;
+			h = false;
+		}
+		else//ptrz->balance == 1
+		{
+			ptr->balance = 0;
+			ptrz->balance = 0;
+		}
+
+		updateCount(ptr);
+		ptr = ptrz;
+	}
+	else//ptrz->balance == -1
+    {
+		//Rotação dupla esquerda
+		Node* ptry = ptrz->left;
+
+		ptrz->left = ptry->right;
+		ptry->right = ptrz;
+		ptr->right = ptry->left;
+		ptry->left = ptr;
+
+		if(ptry->balance == 1)
+			ptr->balance = -1;
+		else
+			ptr->balance = 0;
+
+		if(ptry->balance == -1)
+			ptrz->balance = 1;
+		else
+			ptrz->balance = 0;
+
+		updateCount(ptr);
+		updateCount(ptrz);
+		ptr = ptry;
+		ptr->balance = 0;
+	}
+
+	updateCount(ptr);
+}
+
+void AvlTree::removeRightRotation(Node*& ptr, bool& h)
+{
+    Node* ptrz = ptr->left;
+
+    if(ptrz->balance <= 0)
+    {
+        ptr->left = ptrz->right;
+        ptrz->right = ptr;
+
+        if(ptrz->balance == 0)
+        {
+            ptr->balance = -1;
+            ptrz->balance = 1;
+            h = false;
+        }
+        else
+        {
+            ptr->balance = 0;
+            ptrz->balance = 0;
+        }
+
+        updateCount(ptr);
+        ptr = ptrz;
+    }
+    else
+    {
+        Node* ptry = ptrz->right;
+
+        ptrz->right = ptry->left;
+        ptry->left = ptrz;
+        ptr->left = ptry->right;
+        ptry->right = ptr;
+
+        if(ptry->balance == -1)
+            ptr->balance = 1;
+        else
+            ptr->balance = 0;
+
+        if(ptry->balance == 1)
+            ptrz->balance = -1;
+        else
+            ptrz->balance = 0;
+
+        updateCount(ptr);
+        updateCount(ptrz);
+        ptr = ptry;
+        ptr->balance = 0;
+    }
+
+    updateCount(ptr);
+}
+
+int AvlTree::count(Node* node)
+{
+    return node == 0 ? 0 : node->count;
+}
+
+//Refaz a contagem de um nó a partir das dos filhos
+void AvlTree::updateCount(Node* node)
+{
+    node->count = count(node->left) + count(node->right) + 1;
+}
+
+AvlTree::Iterator AvlTree::select(int k)
+{
+    Iterator it(root);
+
+    if (k < 0 || k >= count(root))
+        return it;
+
+    Node* cur = root;
+
+    while (true)
+    {
+        it.path[it.depth++] = cur;
+
+        int left = count(cur->left);
+
+        if (k == left)
+            return it;
+
+        if (k < left)
+            cur = cur->left;
+        else
+        {
+            k -= left + 1;
+            cur = cur->right;
+        }
+    }
+}
+
+int AvlTree::rank(int info)
+{
+    Node* cur = root;
+    int smaller = 0;
+
+    while (cur != 0)
+    {
+        if (info <= cur->info)
+            cur = cur->left;
+        else
+        {
+            smaller += count(cur->left) + 1;
+            cur = cur->right;
+        }
+    }
+
+    return smaller;
+}
+
+//Os valores vão em ordem, pelo iterador, direto para o vetor
+FrozenTree* AvlTree::freeze()
+{
+    return new FrozenTree(begin(), numberOfNodes);
+}
+
+bool AvlTree::saveSnapshot(const char* fileName)
+{
+    FILE* out = fopen(fileName, "wb");
+
+    if (out == 0)
+    {
+        printf("Erro ao abrir o arquivo %s\n", fileName);
+        return false;
+    }
+
+    SnapshotWriter writer(out);
+
+    writer.write(TREE_SNAPSHOT_MAGIC);
+    writer.write(numberOfNodes);
+
+    traverseInOrder(root, (Node*) 0, [&](Node* node, int) {
+        writer.write(node->info);
+    });
+
+    bool ok = writer.finish();
+
+    if (fclose(out) != 0)
+        ok = false;
+
+    return ok;
+}
+
+//Retorna false se o arquivo não existir ou não for uma fotografia
+//válida; nesse caso a árvore fica vazia
+bool AvlTree::loadSnapshot(const char* fileName)
+{
+    FILE* in = fopen(fileName, "rb");
+
+    if (in == 0)
+    {
+        printf("Erro ao abrir o arquivo %s\n", fileName);
+        return false;
+    }
+
+    //O tamanho do arquivo tem de bater com o cabeçalho
+    fseek(in, 0, SEEK_END);
+    long length = ftell(in);
+    rewind(in);
+
+    SnapshotReader reader(in);
+    int magic = reader.read();
+    int n = reader.read();
+
+    deleteTree(root);
+    root = 0;
+    numberOfNodes = 0;
+
+    if (reader.failed() || magic != TREE_SNAPSHOT_MAGIC || n < 0 || n > AVL_MAX_NODES ||
+        length != (TREE_SNAPSHOT_HEADER + (long) n) * (long) sizeof(int))
+    {
+        fclose(in);
+        return false;
+    }
+
+    long previous = (long) INT_MIN - 1;
+    bool sorted = true;
+    int height;
+
+    root = restore(reader, n, height, previous, sorted);
+    numberOfNodes = n;
+
+    fclose(in);
+
+    if (!sorted || reader.failed())
+    {
+        deleteTree(root);
+        root = 0;
+        numberOfNodes = 0;
+
+        return false;
+    }
+
+    return true;
+}
+
+//Monta a árvore perfeitamente balanceada com os próximos n valores:
+//a metade menor (arredondada para baixo) à esquerda. A altura da
+//subárvore volta em height, para o fator de balanceamento do pai
+Node* AvlTree::restore(SnapshotReader& in, int n, int& height, long& previous, bool& sorted)
+{
+    if (n == 0)
+    {
+        height = 0;
+        return 0;
+    }
+
+    int leftCount = (n - 1) / 2;
+    int hl, hr;
+    Node* left = restore(in, leftCount, hl, previous, sorted);
+    int value = in.read();
+
+    if (value <= previous)
+        sorted = false;
+
+    previous = value;
+
+    Node* node = pool.create(value);
+
+    node->left = left;
+    node->right = restore(in, n - 1 - leftCount, hr, previous, sorted);
+    node->balance = hr - hl;
+    node->count = n;
+
+    height = (hl > hr ? hl : hr) + 1;
+
+    return node;
+}
+
+bool AvlTree::contains(int info)
+{
+	Node* cur = root;
+	int cmp;
+
+	while(cur != 0)
+    {
+		cmp = cur->info - info;
+
+		if(cmp == 0)
+			return true;
+
+		//cur = cmp < 0 ? cur->right : cur->left;
+
+		if (cmp < 0)
+            cur = cur->right;
+        else
+            cur = cur->left;
+
+	}
+
+	return false;
+}
+
+AvlTree::Iterator AvlTree::begin()
+{
+    Iterator it(root);
+
+    it.pushLeft(root);
+
+    return it;
+}
+
+AvlTree::Iterator AvlTree::end()
+{
+    return Iterator(root);
+}
+
+//Desce guardando o caminho e depois o corta no último nó >= info
+AvlTree::Iterator AvlTree::lowerBound(int info)
+{
+    Iterator it(root);
+    int bound = 0;
+
+    for (Node* cur = root; cur != 0; )
+    {
+        it.path[it.depth++] = cur;
+
+        if (cur->info >= info)
+        {
+            bound = it.depth;
+            cur = cur->left;
+        }
+        else
+            cur = cur->right;
+    }
+
+    it.depth = bound;
+
+    return it;
+}
+
+AvlTree::Iterator AvlTree::upperBound(int info)
+{
+    Iterator it(root);
+    int bound = 0;
+
+    for (Node* cur = root; cur != 0; )
+    {
+        it.path[it.depth++] = cur;
+
+        if (cur->info > info)
+        {
+            bound = it.depth;
+            cur = cur->left;
+        }
+        else
+            cur = cur->right;
+    }
+
+    it.depth = bound;
+
+    return it;
+}
+
+void AvlTree::printPre(Node* node)
+{
+	/*
+	if(node != 0) {
+		printf("%d\n", node->info);
+		printPre(node->left);
+		printPre(node->right);
+	}
+	*/
+	printAscii(node);
+}
+
+void AvlTree::printOrder(Node* node)
+{
+    OutputBuffer out;
+
+    traverseInOrder(node, (Node*) 0, [&](Node* n, int) {
+        out.write(n->info);
+        out.write('\n');
+    });
+}
+
+void AvlTree::printPos(Node* node)
+{
+    OutputBuffer out;
+
+    traversePosOrder(node, (Node*) 0, [&](Node* n, int) {
+        out.write(n->info);
+        out.write('\n');
+    });
+}
+
+//Libera a subárvore sem recursão: enquanto o nó tiver filho esquerdo,
+//gira à direita; sem ele, libera o nó e segue para a direita
+void AvlTree::deleteTree(Node* node)
+{
+	while (node != 0)
+    {
+		if (node->left != 0)
+		{
+			Node* left = node->left;
+
+			node->left = left->right;
+			left->right = node;
+			node = left;
+		}
+		else
+		{
+			Node* right = node->right;
+
+			pool.release(node);
+			node = right;
+		}
+	}
+}
+
+//Em uma AVL a altura segue sempre o filho mais alto, indicado pelo
+//fator de balanceamento, então basta um caminho da raiz até uma folha
+int AvlTree::heightNodeTree(Node* node)
+{
+    int height = 0;
+
+    while (node != 0)
+    {
+        height++;
+
+        if (node->balance < 0)
+            node = node->left;
+        else
+            node = node->right;
+    }
+
+    return height;
+}
@@ -0,0 +1,203 @@
+
+#include "../NodePool.h"
+#include "../FrozenTree.h"
+#include "../Traversal.h"
+#include "../TreeSnapshot.h"
+
+//Quantidade máxima de nós, limitada pelo campo count de Node
+#define AVL_MAX_NODES ((1 << 30) - 1)
+
+//Altura máxima de uma AVL com até 2^30 nós (1,44 log2 n)
+#define AVL_MAX_HEIGHT 48
+
+class Node
+{
+    public:
+        Node* left;
+        Node* right;
+        int info;      
+        signed int balance : 2;  //-1, 0 ou 1
+        unsigned int count : 30; //nós da subárvore, contando este
+        
+        Node(int);
+};
+
+//Árvore AVL de inteiros sem repetição. Cada nó guarda o tamanho da
+//sua subárvore em 30 bits, então a árvore tem no máximo
+//AVL_MAX_NODES nós: a partir daí insert recusa novas chaves
+class AvlTree
+{
+    private:
+        Node* root;
+        int numberOfNodes;
+        NodePool<Node> pool; //todos os nós da árvore
+
+        void rightRotation(Node*&);
+        void leftRotation(Node*&);
+        void removeLeftRotation(Node*&, bool&);
+        void removeRightRotation(Node*&, bool&);
+        static int count(Node*);
+        static void updateCount(Node*);
+        Node* restore(SnapshotReader&, int, int&, long&, bool&);
+
+    public:
+        AvlTree();
+        ~AvlTree();
+
+        bool insert(int);
+        bool remove(int);
+        bool contains(int);
+        void deleteTree(Node*);
+        int heightNodeTree(Node*);
+
+
+        void printAscii(Node*);
+        void printPre(Node*);
+        void printOrder(Node*);
+        void printPos(Node*);
+
+        int size();
+        bool isEmpty();
+        void printPre();
+        void printOrder();
+        void printPos();
+        Node* getRoot();
+
+        //Percursos sem recursão, que chamam visit(node, depth)
+        template <class Visitor>
+        void visitPreOrder(Visitor visit)
+        {
+            traversePreOrder(root, (Node*) 0, visit);
+        }
+
+        template <class Visitor>
+        void visitInOrder(Visitor visit)
+        {
+            traverseInOrder(root, (Node*) 0, visit);
+        }
+
+        template <class Visitor>
+        void visitPosOrder(Visitor visit)
+        {
+            traversePosOrder(root, (Node*) 0, visit);
+        }
+
+        //Iterador bidirecional em ordem crescente. Como os nós não têm
+        //ponteiro para o pai, guarda o caminho da raiz até o nó atual;
+        //end() é o caminho vazio. Deixa de ser válido quando a árvore
+        //é alterada
+        class Iterator
+        {
+            private:
+                Node* root;
+                Node* path[AVL_MAX_HEIGHT];
+                int depth;  //path[depth - 1] é o nó atual
+
+                void pushLeft(Node* node)
+                {
+                    for (; node != 0; node = node->left)
+                        path[depth++] = node;
+                }
+
+                void pushRight(Node* node)
+                {
+                    for (; node != 0; node = node->right)
+                        path[depth++] = node;
+                }
+
+                friend class AvlTree;
+
+            public:
+                Iterator(Node* root)
+                {
+                    this->root = root;
+                    depth = 0;
+                }
+
+                const int& operator*() const
+                {
+                    return path[depth - 1]->info;
+                }
+
+                Iterator& operator++()
+                {
+                    Node* node = path[depth - 1];
+
+                    if (node->right != 0)
+                        pushLeft(node->right);
+                    else
+                    {
+                        //Sobe enquanto vier da subárvore direita
+                        do
+                            node = path[--depth];
+                        while (depth > 0 && path[depth - 1]->right == node);
+                    }
+
+                    return *this;
+                }
+
+                //Decrementar end() leva ao maior valor
+                Iterator& operator--()
+                {
+                    if (depth == 0)
+                    {
+                        pushRight(root);
+                        return *this;
+                    }
+
+                    Node* node = path[depth - 1];
+
+                    if (node->left != 0)
+                        pushRight(node->left);
+                    else
+                    {
+                        do
+                            node = path[--depth];
+                        while (depth > 0 && path[depth - 1]->left == node);
+                    }
+
+                    return *this;
+                }
+
+                bool operator==(const Iterator& other) const
+                {
+                    if (depth != other.depth)
+                        return false;
+
+                    return depth == 0 || path[depth - 1] == other.path[depth - 1];
+                }
+
+                bool operator!=(const Iterator& other) const
+                {
+                    return !(*this == other);
+                }
+        };
+
+        Iterator begin();
+        Iterator end();
+        Iterator lowerBound(int);  //primeiro valor >= x
+        Iterator upperBound(int);  //primeiro valor > x
+
+        //Estatísticas de ordem, em O(log n)
+        Iterator select(int);  //k-ésimo menor, a partir de 0; end() se não houver
+        int rank(int);         //quantidade de valores menores que x
+
+        //Cópia somente leitura para consultas rápidas; quem chama a libera
+        FrozenTree* freeze();
+
+        //Grava e carrega a árvore no formato de TreeSnapshot.h; a carga
+        //substitui o conteúdo atual
+        bool saveSnapshot(const char*);
+        bool loadSnapshot(const char*);
+
+        //Chama visit(valor) para cada valor em [lo, hi], em ordem
+        //crescente, em O(log n + k)
+        template <class Visitor>
+        void range(int lo, int hi, Visitor visit)
+        {
+            Iterator stop = end();
+
+            for (Iterator it = lowerBound(lo); it != stop && *it <= hi; ++it)
+                visit(*it);
+        }
+};
\ No newline at end of file
@@ -0,0 +1,61 @@
+//Mede a vazão de insert, contains e remove da AvlTree sobre n inteiros
+//sorteados e sobre n inteiros em ordem crescente (o pior caso para a
+//profundidade da recursão, com uma rotação a cada poucas inserções).
+//
+//Compilação, a partir do diretório avl2020:
+//  g++ -std=c++11 -O2 -I. bench/insercao.cpp AvlTree.cpp -o insercao
+//
+//Uso: insercao [quantidade de chaves]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include "AvlTree.h"
+#include "../../Bench.h"
+
+static void medir(const char* nome, int* chaves, int n)
+{
+    AvlTree* tree = new AvlTree();
+    int achados = 0;
+
+    std::chrono::steady_clock::time_point inicio = agora();
+    for (int i = 0; i < n; i++)
+        tree->insert(chaves[i]);
+    double insercao = segundos(inicio);
+
+    inicio = agora();
+    for (int i = 0; i < n; i++)
+        achados += tree->contains(chaves[i]);
+    double busca = segundos(inicio);
+
+    inicio = agora();
+    for (int i = 0; i < n; i++)
+        tree->remove(chaves[i]);
+    double remocao = segundos(inicio);
+
+    printf("%-10s insert %.3f s  contains %.3f s  remove %.3f s  (%d achados)\n",
+           nome, insercao, busca, remocao, achados);
+
+    delete tree;
+}
+
+int main(int argc, char** argv)
+{
+    int n = argc > 1 ? atoi(argv[1]) : 2000000;
+    int* chaves = new int[n];
+
+    printf("%d chaves\n", n);
+
+    semente = 9;
+    for (int i = 0; i < n; i++)
+        chaves[i] = proximo();
+    medir("aleatorias", chaves, n);
+
+    for (int i = 0; i < n; i++)
+        chaves[i] = i;
+    medir("crescentes", chaves, n);
+
+    delete[] chaves;
+
+    return 0;
+}
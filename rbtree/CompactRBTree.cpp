@@ -0,0 +1,493 @@
+#include <stdlib.h>
+#include <new>
+#include "CompactRBTree.h"
+#include "../OutputBuffer.h"
+
+#define NIL 0
+
+//Cria a árvore apenas com o nil, preto, no índice 0
+CompactRBTree::CompactRBTree()
+{
+    capacity = 0;
+    nodes = 0;
+    reserve(16);
+
+    nodes[NIL].left = nodes[NIL].right = NIL;
+    nodes[NIL].parent = NIL | COMPACT_BLACK;
+    nodes[NIL].value = 0;
+
+    used = 1;
+    freeList = NIL;
+    root = NIL;
+    numberOfNodes = 0;
+}
+
+//Libera o vetor de nós de uma só vez
+CompactRBTree::~CompactRBTree()
+{
+    free(nodes);
+}
+
+int CompactRBTree::size() const
+{
+    return numberOfNodes;
+}
+
+bool CompactRBTree::isEmpty() const
+{
+    return numberOfNodes == 0;
+}
+
+//Garante espaço para n nós, além do nil
+void CompactRBTree::reserve(unsigned int n)
+{
+    if (n + 1 <= capacity)
+        return;
+
+    CompactNode* bigger = (CompactNode*) realloc(nodes, (size_t) (n + 1) * sizeof(CompactNode));
+
+    if (bigger == 0)
+        throw std::bad_alloc();
+
+    nodes = bigger;
+    capacity = n + 1;
+}
+
+//Bytes ocupados pelo vetor de nós
+long CompactRBTree::memoryUsage() const
+{
+    return (long) capacity * sizeof(CompactNode);
+}
+
+unsigned int CompactRBTree::parent(unsigned int node)
+{
+    return nodes[node].parent & COMPACT_INDEX;
+}
+
+void CompactRBTree::setParent(unsigned int node, unsigned int p)
+{
+    nodes[node].parent = (nodes[node].parent & COMPACT_BLACK) | p;
+}
+
+bool CompactRBTree::isBlack(unsigned int node)
+{
+    return (nodes[node].parent & COMPACT_BLACK) != 0;
+}
+
+void CompactRBTree::setColor(unsigned int node, bool black)
+{
+    if (black)
+        nodes[node].parent |= COMPACT_BLACK;
+    else
+        nodes[node].parent &= COMPACT_INDEX;
+}
+
+//Obtém um nó vermelho com o valor, da lista livre ou do fim do vetor
+unsigned int CompactRBTree::newNode(int value)
+{
+    unsigned int node;
+
+    if (freeList != NIL)
+    {
+        node = freeList;
+        freeList = nodes[node].left;
+    }
+    else
+    {
+        if (used == capacity)
+        {
+            if (capacity > COMPACT_INDEX / 2)
+                throw std::bad_alloc();
+
+            reserve(2 * capacity - 1);
+        }
+
+        node = used++;
+    }
+
+    nodes[node].left = NIL;
+    nodes[node].right = NIL;
+    nodes[node].parent = NIL;
+    nodes[node].value = value;
+
+    return node;
+}
+
+void CompactRBTree::freeNode(unsigned int node)
+{
+    nodes[node].left = freeList;
+    freeList = node;
+}
+
+void CompactRBTree::print()
+{
+    print(root);
+}
+
+//Implementação da inserção de acordo com Cormen
+bool CompactRBTree::insert(int value)
+{
+    unsigned int y = NIL;
+    unsigned int x = root;
+
+    while (x != NIL)
+    {
+        y = x;
+
+        if (nodes[x].value == value)
+            return false;
+
+        if (value < nodes[x].value)
+            x = nodes[x].left;
+        else
+            x = nodes[x].right;
+    }
+
+    unsigned int node = newNode(value);
+    setParent(node, y);
+
+    if (y == NIL)
+        root = node;
+    else
+    {
+        if (value < nodes[y].value)
+            nodes[y].left = node;
+        else
+            nodes[y].right = node;
+    }
+
+    insertFixUp(node);
+
+    numberOfNodes++;
+
+    return true;
+}
+
+void CompactRBTree::insertFixUp(unsigned int node)
+{
+    unsigned int y;
+
+    while (!isBlack(parent(node)))
+    {
+        unsigned int p = parent(node);
+        unsigned int g = parent(p);
+
+        if (p == nodes[g].left)
+        {
+            y = nodes[g].right;
+
+            if (!isBlack(y)) //Caso 1
+            {
+                setColor(p, true);
+                setColor(y, true);
+                setColor(g, false);
+                node = g;
+            }
+            else
+            {
+                if (node == nodes[p].right) //Caso 2
+                {
+                    node = p;
+                    leftRotation(node);
+                }
+
+                setColor(parent(node), true); //Caso 3
+                setColor(parent(parent(node)), false);
+                rightRotation(parent(parent(node)));
+            }
+        }
+        else
+        {
+            y = nodes[g].left;
+
+            if (!isBlack(y)) //Caso 1
+            {
+                setColor(p, true);
+                setColor(y, true);
+                setColor(g, false);
+                node = g;
+            }
+            else
+            {
+                if (node == nodes[p].left) //Caso 2
+                {
+                    node = p;
+                    rightRotation(node);
+                }
+
+                setColor(parent(node), true);
+                setColor(parent(parent(node)), false);
+                leftRotation(parent(parent(node)));
+            }
+        }
+    }//Fim do while
+
+    //Colore a raiz de preto
+    setColor(root, true);
+}
+
+bool CompactRBTree::remove(int value)
+{
+    unsigned int z = root;
+    unsigned int x;
+    unsigned int y;
+
+    //Busca pelo elemento
+    while (z != NIL && nodes[z].value != value)
+    {
+        if (value < nodes[z].value)
+            z = nodes[z].left;
+        else
+            z = nodes[z].right;
+    }
+
+    //Se chegou no nil, é porque não encontrou e não precisa remover
+    if (z == NIL)
+        return false;
+
+    //Tem 0 ou 1 filho
+    if (nodes[z].left == NIL || nodes[z].right == NIL)
+        y = z;
+    else
+        y = successor(z);
+
+    if (nodes[y].left != NIL)
+        x = nodes[y].left;
+    else
+        x = nodes[y].right;
+
+    //Como na RBTree, o pai do nil também é alterado
+    setParent(x, parent(y));
+
+    if (parent(y) == NIL)
+        root = x;
+    else
+    {
+        if (y == nodes[parent(y)].left)
+            nodes[parent(y)].left = x;
+        else
+            nodes[parent(y)].right = x;
+    }
+
+    if (y != z)
+        nodes[z].value = nodes[y].value;
+
+    if (isBlack(y))
+        removeFixUp(x);
+
+    freeNode(y);
+    numberOfNodes--;
+
+    return true;
+}
+
+void CompactRBTree::removeFixUp(unsigned int x)
+{
+    unsigned int w;
+
+    while (x != root && isBlack(x))
+    {
+        unsigned int p = parent(x);
+
+        //Se x for filho esquerdo
+        if (x == nodes[p].left)
+        {
+            w = nodes[p].right;
+
+            if (!isBlack(w)) //Caso 1
+            {
+                setColor(w, true);
+                setColor(p, false);
+                leftRotation(p);
+                w = nodes[p].right;
+            }
+
+            if (isBlack(nodes[w].left) && isBlack(nodes[w].right)) //Caso 2
+            {
+                setColor(w, false);
+                x = p;
+            }
+            else
+            {
+                if (isBlack(nodes[w].right)) //Caso 3
+                {
+                    setColor(nodes[w].left, true);
+                    setColor(w, false);
+                    rightRotation(w);
+                    w = nodes[p].right;
+                }
+
+                //Caso 4
+                setColor(w, isBlack(p));
+                setColor(p, true);
+                setColor(nodes[w].right, true);
+                leftRotation(p);
+
+                x = root;
+            }
+        }
+        else //x é filho direito
+        {
+            w = nodes[p].left;
+
+            if (!isBlack(w)) //Caso 1
+            {
+                setColor(w, true);
+                setColor(p, false);
+                rightRotation(p);
+                w = nodes[p].left;
+            }
+
+            if (isBlack(nodes[w].right) && isBlack(nodes[w].left)) //Caso 2
+            {
+                setColor(w, false);
+                x = p;
+            }
+            else
+            {
+                if (isBlack(nodes[w].left)) //Caso 3
+                {
+                    setColor(nodes[w].right, true);
+                    setColor(w, false);
+                    leftRotation(w);
+                    w = nodes[p].left;
+                }
+
+                //Caso 4
+                setColor(w, isBlack(p));
+                setColor(p, true);
+                setColor(nodes[w].left, true);
+                rightRotation(p);
+
+                x = root;
+            }
+        }
+    }
+
+    setColor(x, true);
+}
+
+unsigned int CompactRBTree::successor(unsigned int node)
+{
+    unsigned int suc = nodes[node].right;
+
+    while (nodes[suc].left != NIL)
+        suc = nodes[suc].left;
+
+    return suc;
+}
+
+bool CompactRBTree::contains(int value)
+{
+    unsigned int x = root;
+
+    while (x != NIL)
+    {
+        if (nodes[x].value == value)
+            return true;
+
+        if (value < nodes[x].value)
+            x = nodes[x].left;
+        else
+            x = nodes[x].right;
+    }
+
+    return false;
+}
+
+void CompactRBTree::leftRotation(unsigned int node)
+{
+    unsigned int y = nodes[node].right;
+    nodes[node].right = nodes[y].left;
+
+    if (nodes[y].left != NIL)
+        setParent(nodes[y].left, node);
+
+    setParent(y, parent(node));
+    if (parent(node) == NIL)
+        root = y;
+    else
+    {
+        if (node == nodes[parent(node)].left)
+            nodes[parent(node)].left = y;
+        else
+            nodes[parent(node)].right = y;
+    }
+
+    nodes[y].left = node;
+    setParent(node, y);
+}
+
+void CompactRBTree::rightRotation(unsigned int node)
+{
+    unsigned int y = nodes[node].left;
+    nodes[node].left = nodes[y].right;
+
+    if (nodes[y].right != NIL)
+        setParent(nodes[y].right, node);
+
+    setParent(y, parent(node));
+    if (parent(node) == NIL)
+        root = y;
+    else
+    {
+        if (node == nodes[parent(node)].right)
+            nodes[parent(node)].right = y;
+        else
+            nodes[parent(node)].left = y;
+    }
+
+    nodes[y].right = node;
+    setParent(node, y);
+}
+
+//Pré-ordem com os nil, indentada pela profundidade. A altura da
+//árvore é no máximo 2 log2(n + 1) < 64, então a pilha tem tamanho fixo
+void CompactRBTree::print(unsigned int node)
+{
+    OutputBuffer out;
+    unsigned int stack[128];
+    int depths[128];
+    int top = 0;
+
+    stack[top] = node;
+    depths[top++] = 0;
+
+    while (top > 0)
+    {
+        node = stack[--top];
+        int depth = depths[top];
+
+        out.spaces(3 * depth);
+
+        if (node == NIL)
+        {
+            out.write("-[B]\n");
+            continue;
+        }
+
+        out.write(nodes[node].value);
+
+        if (isBlack(node))
+            out.write("[B]\n");
+        else
+            out.write("[R]\n");
+
+        stack[top] = nodes[node].right;
+        depths[top++] = depth + 1;
+        stack[top] = nodes[node].left;
+        depths[top++] = depth + 1;
+    }
+}
+
+//Altura negra contada pelo caminho mais à esquerda, como na RBTree
+int CompactRBTree::blackHeight()
+{
+    int height = 0;
+
+    for (unsigned int node = root; node != NIL; node = nodes[node].left)
+        if (isBlack(nodes[node].left))
+            height++;
+
+    return height;
+}
@@ -0,0 +1,73 @@
+#ifndef COMPACTRBTREE_H
+#define COMPACTRBTREE_H
+
+#include <iostream>
+
+using namespace std;
+
+//Nó compacto: em vez de ponteiros, índices de 32 bits no vetor de
+//nós da árvore. O bit mais alto de parent guarda a cor, então o nó
+//ocupa 16 bytes (o Node da RBTree ocupa 32, mais o cabeçalho do
+//malloc quando alocado com new).
+class CompactNode
+{
+    public:
+        unsigned int left;
+        unsigned int right;
+        unsigned int parent; //bit 31: cor; bits 0 a 30: índice do pai
+        int value;
+};
+
+#define COMPACT_BLACK 0x80000000u
+#define COMPACT_INDEX 0x7fffffffu
+
+//Definição da classe que representa uma árvore rubro-negra compacta,
+//com a mesma interface e os mesmos algoritmos (Cormen) da RBTree.
+//Todos os nós ficam em um único vetor contíguo, que dobra quando
+//enche; o nó 0 é o nil. Os nós removidos formam uma lista livre
+//(ligada por left) e são reaproveitados. Cabem até 2^31 - 1 nós.
+
+class CompactRBTree
+{
+    private:
+        CompactNode* nodes;
+        unsigned int capacity;
+        unsigned int used;      //nós já usados do vetor, incluindo o nil
+        unsigned int freeList;  //primeiro nó livre (0 se não houver)
+        unsigned int root;
+        int numberOfNodes;
+
+        unsigned int parent(unsigned int);
+        void setParent(unsigned int, unsigned int);
+        bool isBlack(unsigned int);
+        void setColor(unsigned int, bool);
+
+        unsigned int newNode(int);
+        void freeNode(unsigned int);
+
+        void leftRotation(unsigned int);
+        void rightRotation(unsigned int);
+        unsigned int successor(unsigned int);
+        void print(unsigned int);
+        void insertFixUp(unsigned int);
+        void removeFixUp(unsigned int);
+
+    public:
+        CompactRBTree();
+        ~CompactRBTree();
+
+        bool insert(int);
+        bool remove(int);
+        bool contains(int);
+
+        void reserve(unsigned int);
+        long memoryUsage() const;
+
+        void print();
+        int size() const;
+        bool isEmpty() const;
+
+        int blackHeight();
+};
+
+#endif
@@ -0,0 +1,1249 @@
+#include <limits.h>
+#include <stdio.h>
+#include <thread>
+#include "RBTree.h"
+#include "../OutputBuffer.h"
+
+//Implementações da classe Node
+Node::Node()
+{
+    left = right = parent = 0;
+    color = BLACK;
+    count = 0;
+}
+
+Node::Node(int value)
+{
+    this->value = value;
+}
+
+//Implementações da classe RBTree
+RBTree::RBTree()
+{
+	nil = new Node();
+	root = nil;
+}
+
+//Os nós são liberados de uma vez com o pool
+RBTree::~RBTree()
+{
+	root = nil;
+	delete nil;
+}
+
+void RBTree::print()
+{
+    print(root);
+}
+
+//A quantidade de nós é a contagem da subárvore da raiz (0 no nil)
+int RBTree::size() const
+{
+    return root->count;
+}
+
+bool RBTree::isEmpty() const
+{
+    return root == nil;
+}
+
+//Bytes ocupados pelos blocos do pool e pelo nil, medidos como em
+//CompactRBTree::memoryUsage
+long RBTree::memoryUsage() const
+{
+    return pool.memoryUsage() + (long) sizeof(Node);
+}
+
+//Implementação da inserção de acordo com Cormen
+bool RBTree::insert(int value)
+{
+	Node* y = nil;
+	Node* x = root;
+
+	while(x != nil)
+    {
+		y = x;
+
+		if(x->value == value)
+			return false;
+
+		//x = value < x->value ? x->left : x->right;
+       if (value < x->value)
+           x = x->left;
+       else
+           x = x->right;
+	}
+
+	Node* node = pool.create(value);
+	node->parent = y;
+
+	if(y == nil)
+		root = node;
+	else
+    {
+		if(value < y->value)
+			y->left = node;
+		else
+			y->right = node;
+	}
+
+	node->left = nil;
+	node->right = nil;
+	node->color = RED;
+	node->count = 1;
+
+	//Os ancestrais ganham um nó; as rotações do fixUp mantêm as contagens
+	for (Node* p = y; p != nil; p = p->parent)
+		p->count++;
+
+	insertFixUp(node);
+
+	return true;
+}
+
+void RBTree::insertFixUp(Node*& node)
+{
+	Node* y;
+
+	while(node->parent->color == RED)
+    {
+		if(node->parent == node->parent->parent->left)
+        {
+			y = node->parent->parent->right;
+
+			if(y->color == RED) //Caso 1
+            {
+				node->parent->color = BLACK;
+				y->color = BLACK;
+				node->parent->parent->color = RED;
+				node = node->parent->parent;
+			}
+			else 
+            {
+				if(node == node->parent->right)//Caso2
+				{
+					node = node->parent;
+					leftRotation(node);
+				}
+
+				node->parent->color = BLACK;//Caso 3
+				node->parent->parent->color = RED;
+				rightRotation(node->parent->parent);
+			}
+		}
+		else
+        {
+			y = node->parent->parent->left;
+
+			if(y->color == RED)//Caso 1
+            {
+				node->parent->color = BLACK;
+				y->color = BLACK;
+				node->parent->parent->color = RED;
+				node = node->parent->parent;
+			}
+			else
+            {
+				if(node == node->parent->left)//Caso 2
+                {
+					node = node->parent;
+					rightRotation(node);
+				}
+
+				node->parent->color = BLACK;
+				node->parent->parent->color = RED;
+				leftRotation(node->parent->parent);
+			}
+		}
+	}//Fim do while
+
+    //Colore a raiz de preto
+	root->color = BLACK;
+}
+
+bool RBTree::remove(int value)
+{
+    Node* z = root;
+    Node* x;
+    Node* y;
+
+    //Busca pelo elemento
+    while(z != nil && z->value != value)
+    {
+       if (value < z->value)
+           z = z->left;
+       else
+           z = z->right;
+    }
+
+	//Se chegou no nil, é porque não encontrou e não precisa remover
+    if (z == nil)
+        return false;
+
+	//Tem 0 ou 1 filho
+    if (z->left == nil || z->right == nil)
+		y = z;
+	else
+		y = successor(z);
+
+	if (y->left != nil)
+		x = y->left;
+	else
+		x = y->right;
+
+	x->parent = y->parent;
+
+	if (y->parent == nil)
+		root = x;
+	else
+	{
+		if (y == y->parent->left)
+			y->parent->left = x;
+		else
+			y->parent->right = x;
+	}
+
+	if (y != z)
+		z->value = y->value;
+
+	//Os ancestrais de y perdem um nó
+	for (Node* p = y->parent; p != nil; p = p->parent)
+		p->count--;
+
+	if (y->color == BLACK)
+		removeFixUp(x);
+
+	pool.release(y);
+
+	return true;
+}
+
+void RBTree::removeFixUp(Node*& x)
+{
+    Node* w;
+
+    while (x != root && x->color == BLACK)
+    {
+        //Se x for filho esquerdo
+        if (x == x->parent->left)
+        {
+            w = x->parent->right;
+
+            if (w->color == RED) //Caso 1
+            {
+                w->color = BLACK;
+                x->parent->color = RED;
+                leftRotation(x->parent);
+                w = x->parent->right;
+            }
+
+            if (w->left->color == BLACK && w->right->color == BLACK) //Caso 2
+            {
+                w->color = RED;
+                x = x->parent;
+            }
+            else
+            {
+                if (w->right->color == BLACK) //Caso 3
+                {
+                    w->left->color = BLACK;
+                    w->color = RED;
+                    rightRotation(w);
+                    w = x->parent->right;
+                }
+
+                //Caso 4
+                w->color = x->parent->color;
+                x->parent->color = BLACK;
+                w->right->color = BLACK;
+                leftRotation(x->parent);
+
+                x = root;
+            }
+        }
+        else //x é filho direito
+        {
+            w = x->parent->left;
+
+            if (w->color == RED) //Caso 1
+            {
+                w->color = BLACK;
+                x->parent->color = RED;
+                rightRotation(x->parent);
+                w = x->parent->left;
+            }
+
+            if (w->right->color == BLACK && w->left->color == BLACK) //Caso 2
+            {
+                w->color = RED;
+                x = x->parent;
+            }
+            else
+            {
+                if (w->left->color == BLACK) //Caso 3
+                {
+                    w->right->color = BLACK;
+                    w->color = RED;
+                    leftRotation(w);
+                    w = x->parent->left;
+                }
+
+                //Caso 4
+                w->color = x->parent->color;
+                x->parent->color = BLACK;
+                w->left->color = BLACK;
+                rightRotation(x->parent);
+
+                x = root;
+            }
+        }
+    }
+    x->color = BLACK;
+}
+
+Node* RBTree::successor(Node* node)
+{
+    Node* suc = node->right;
+
+    while (suc->left != nil)
+        suc = suc->left;
+
+    return suc;
+}
+
+Node* RBTree::minimum(Node* node) const
+{
+    while (node->left != nil)
+        node = node->left;
+
+    return node;
+}
+
+Node* RBTree::maximum(Node* node) const
+{
+    while (node->right != nil)
+        node = node->right;
+
+    return node;
+}
+
+//Próximo nó em ordem; depois do maior vem o nil
+Node* RBTree::next(Node* node) const
+{
+    if (node->right != nil)
+        return minimum(node->right);
+
+    Node* y = node->parent;
+
+    while (y != nil && node == y->right)
+    {
+        node = y;
+        y = y->parent;
+    }
+
+    return y;
+}
+
+//Nó anterior em ordem; antes do nil vem o maior
+Node* RBTree::previous(Node* node) const
+{
+    if (node == nil)
+        return root == nil ? nil : maximum(root);
+
+    if (node->left != nil)
+        return maximum(node->left);
+
+    Node* y = node->parent;
+
+    while (y != nil && node == y->left)
+    {
+        node = y;
+        y = y->parent;
+    }
+
+    return y;
+}
+
+RBTree::Iterator RBTree::begin() const
+{
+    return Iterator(this, root == nil ? nil : minimum(root));
+}
+
+RBTree::Iterator RBTree::end() const
+{
+    return Iterator(this, nil);
+}
+
+RBTree::Iterator RBTree::lowerBound(int value) const
+{
+    Node* x = root;
+    Node* bound = nil;
+
+    while (x != nil)
+    {
+        if (x->value >= value)
+        {
+            bound = x;
+            x = x->left;
+        }
+        else
+            x = x->right;
+    }
+
+    return Iterator(this, bound);
+}
+
+RBTree::Iterator RBTree::upperBound(int value) const
+{
+    Node* x = root;
+    Node* bound = nil;
+
+    while (x != nil)
+    {
+        if (x->value > value)
+        {
+            bound = x;
+            x = x->left;
+        }
+        else
+            x = x->right;
+    }
+
+    return Iterator(this, bound);
+}
+
+RBTree::Iterator RBTree::select(int k) const
+{
+    Node* x = root;
+
+    if (k < 0 || k >= root->count)
+        return end();
+
+    while (k != x->left->count)
+    {
+        if (k < x->left->count)
+            x = x->left;
+        else
+        {
+            k -= x->left->count + 1;
+            x = x->right;
+        }
+    }
+
+    return Iterator(this, x);
+}
+
+int RBTree::rank(int value) const
+{
+    Node* x = root;
+    int smaller = 0;
+
+    while (x != nil)
+    {
+        if (value <= x->value)
+            x = x->left;
+        else
+        {
+            smaller += x->left->count + 1;
+            x = x->right;
+        }
+    }
+
+    return smaller;
+}
+
+bool RBTree::contains(int value)
+{
+	Node* x = root;
+
+	while(x != nil)
+    {
+		if(x->value == value)
+			return true;
+
+		//x = value < x->value ? x->left : x->right;
+       if (value < x->value)
+           x = x->left;
+       else
+           x = x->right;
+	}
+
+	return false;
+}
+
+void RBTree::leftRotation(Node* node)
+{
+	Node* y = node->right;
+	node->right = y->left;
+
+	if(y->left != nil)
+		y->left->parent = node;
+
+	y->parent = node->parent;
+	if(node->parent == nil)
+		root = y;
+	else
+    {
+		if(node == node->parent->left)
+			node->parent->left = y;
+		else
+			node->parent->right = y;
+	}
+
+	y->left = node;
+	node->parent = y;
+
+	y->count = node->count;
+	node->count = node->left->count + node->right->count + 1;
+}
+
+void RBTree::rightRotation(Node* node)
+{
+	Node* y = node->left;
+	node->left = y->right;
+
+	if(y->right != nil)
+		y->right->parent = node;
+
+	y->parent = node->parent;
+	if(node->parent == nil)
+		root = y;
+	else
+    {
+		if(node == node->parent->right)
+			node->parent->right = y;
+		else
+			node->parent->left = y;
+	}
+
+	y->right = node;
+	node->parent = y;
+
+	y->count = node->count;
+	node->count = node->left->count + node->right->count + 1;
+}
+
+void RBTree::deleteTree(Node* node)
+{
+	if(node != nil)
+    {
+		deleteTree(node->left);
+		deleteTree(node->right);
+		pool.release(node);
+	}
+}
+
+//Pré-ordem com os nil, indentada pela profundidade
+void RBTree::print(Node* node)
+{
+    OutputBuffer out;
+
+    traversePreOrder(node, nil, [&](Node* n, int depth) {
+        out.spaces(3 * depth);
+
+        if (n == nil)
+        {
+            out.write("-[B]\n");
+            return;
+        }
+
+        out.write(n->value);
+
+        if (n->color == BLACK)
+            out.write("[B]\n");
+        else
+            out.write("[R]\n");
+    }, true);
+}
+
+int RBTree::blackHeight(Node* node)
+{
+	if (node == nil)
+		return 0;
+		
+	if (node->left->color == BLACK)
+		return blackHeight(node->left) + 1;
+	
+	return blackHeight(node->left);
+}
+
+//Operações de conjunto baseadas em join (Blelloch, Ferizovic e Sun,
+//"Just Join for Parallel Ordered Sets"). join(l, k, r) junta duas
+//árvores rubro-negras e um nó k com l < k < r em O(|hl - hr|); split,
+//união, interseção e diferença são escritas só com join. Elas
+//trabalham sobre subárvores soltas, cujo parent só é acertado quando
+//são penduradas em outro nó, e nunca alteram o nil nem root, por isso
+//as duas metades da recursão podem rodar em threads diferentes.
+
+//Nós pretos da raiz até o nil, contando a raiz e sem contar o nil
+int RBTree::joinHeight(Node* node) const
+{
+    int height = 0;
+
+    for (; node != nil; node = node->left)
+        if (node->color == BLACK)
+            height++;
+
+    return height;
+}
+
+Node* RBTree::makeNode(Node* left, Node* k, Node* right, int color) const
+{
+    k->left = left;
+    k->right = right;
+    k->color = color;
+    k->count = left->count + right->count + 1;
+
+    if (left != nil)
+        left->parent = k;
+
+    if (right != nil)
+        right->parent = k;
+
+    return k;
+}
+
+Node* RBTree::rotateLeft(Node* x) const
+{
+    Node* y = x->right;
+
+    x->right = y->left;
+    if (y->left != nil)
+        y->left->parent = x;
+    x->count = x->left->count + x->right->count + 1;
+
+    y->left = x;
+    x->parent = y;
+    y->count = x->count + y->right->count + 1;
+
+    return y;
+}
+
+Node* RBTree::rotateRight(Node* x) const
+{
+    Node* y = x->left;
+
+    x->left = y->right;
+    if (y->right != nil)
+        y->right->parent = x;
+    x->count = x->left->count + x->right->count + 1;
+
+    y->right = x;
+    x->parent = y;
+    y->count = x->count + y->left->count + 1;
+
+    return y;
+}
+
+//Desce pela borda direita de l até um nó preto com a altura de r e o
+//troca por um nó vermelho (esse nó, k, r). Na volta, dois vermelhos
+//seguidos abaixo de um nó preto são desfeitos com uma rotação
+Node* RBTree::joinRight(Node* l, int hl, Node* k, Node* r, int hr) const
+{
+    if (l->color == BLACK && hl == hr)
+        return makeNode(l, k, r, RED);
+
+    Node* t = joinRight(l->right, hl - (l->color == BLACK), k, r, hr);
+
+    l->right = t;
+    t->parent = l;
+    l->count = l->left->count + t->count + 1;
+
+    if (l->color == BLACK && t->color == RED && t->right->color == RED)
+    {
+        t->right->color = BLACK;
+        return rotateLeft(l);
+    }
+
+    return l;
+}
+
+Node* RBTree::joinLeft(Node* l, int hl, Node* k, Node* r, int hr) const
+{
+    if (r->color == BLACK && hl == hr)
+        return makeNode(l, k, r, RED);
+
+    Node* t = joinLeft(l, hl, k, r->left, hr - (r->color == BLACK));
+
+    r->left = t;
+    t->parent = r;
+    r->count = t->count + r->right->count + 1;
+
+    if (r->color == BLACK && t->color == RED && t->left->color == RED)
+    {
+        t->left->color = BLACK;
+        return rotateRight(r);
+    }
+
+    return r;
+}
+
+Node* RBTree::join(Node* l, int hl, Node* k, Node* r, int hr, int& h) const
+{
+    Node* t;
+
+    if (hl > hr)
+    {
+        t = joinRight(l, hl, k, r, hr);
+        h = hl;
+
+        if (t->color == RED && t->right->color == RED)
+        {
+            t->color = BLACK;
+            h++;
+        }
+    }
+    else if (hr > hl)
+    {
+        t = joinLeft(l, hl, k, r, hr);
+        h = hr;
+
+        if (t->color == RED && t->left->color == RED)
+        {
+            t->color = BLACK;
+            h++;
+        }
+    }
+    else if (l->color == BLACK && r->color == BLACK)
+    {
+        t = makeNode(l, k, r, RED);
+        h = hl;
+    }
+    else
+    {
+        t = makeNode(l, k, r, BLACK);
+        h = hl + 1;
+    }
+
+    return t;
+}
+
+//Junta l < r sem um nó do meio: o maior de l faz esse papel
+Node* RBTree::join2(Node* l, int hl, Node* r, int hr, int& h) const
+{
+    if (l == nil)
+    {
+        h = hr;
+        return r;
+    }
+
+    Node* last;
+    int hrest;
+    Node* rest = splitLast(l, hl, last, hrest);
+
+    return join(rest, hrest, last, r, hr, h);
+}
+
+//Separa o maior nó da árvore t e devolve o restante
+Node* RBTree::splitLast(Node* t, int ht, Node*& last, int& h) const
+{
+    int hc = ht - (t->color == BLACK);
+
+    if (t->right == nil)
+    {
+        last = t;
+        h = hc;
+        return t->left;
+    }
+
+    int hrest;
+    Node* rest = splitLast(t->right, hc, last, hrest);
+
+    return join(t->left, hc, t, rest, hrest, h);
+}
+
+//Divide t nos valores menores (l) e maiores (r) que value; o nó com
+//value, se houver, fica em found
+void RBTree::split(Node* t, int ht, int value, Node*& l, int& hl, Node*& r, int& hr, Node*& found) const
+{
+    if (t == nil)
+    {
+        l = r = nil;
+        hl = hr = 0;
+        found = 0;
+        return;
+    }
+
+    int hc = ht - (t->color == BLACK);
+    Node* tl = t->left;
+    Node* tr = t->right;
+
+    if (value == t->value)
+    {
+        l = tl;
+        hl = hc;
+        r = tr;
+        hr = hc;
+        found = t;
+    }
+    else if (value < t->value)
+    {
+        Node* rl;
+        int hrl;
+
+        split(tl, hc, value, l, hl, rl, hrl, found);
+        r = join(rl, hrl, t, tr, hc, hr);
+    }
+    else
+    {
+        Node* lr;
+        int hlr;
+
+        split(tr, hc, value, lr, hlr, r, hr, found);
+        l = join(tl, hc, t, lr, hlr, hl);
+    }
+}
+
+//Põe a subárvore na lista de descartados
+void RBTree::drop(Node* t, Node*& dropped) const
+{
+    if (t != nil)
+    {
+        t->parent = dropped;
+        dropped = t;
+    }
+}
+
+//Junta a lista de descartados de outra thread à lista dropped
+void RBTree::append(Node* list, Node*& dropped) const
+{
+    if (list == nil)
+        return;
+
+    Node* tail = list;
+
+    while (tail->parent != nil)
+        tail = tail->parent;
+
+    tail->parent = dropped;
+    dropped = list;
+}
+
+//União: divide a pelo valor da raiz de b e une as metades com as
+//subárvores de b, que voltam a ser juntadas pela raiz de b
+Node* RBTree::unite(Node* a, int ha, Node* b, int hb, int& h, Node*& dropped, int threads) const
+{
+    if (b == nil)
+    {
+        h = ha;
+        return a;
+    }
+
+    if (a == nil)
+    {
+        h = hb;
+        return b;
+    }
+
+    bool parallel = threads > 1 && a->count + b->count >= PARALLEL_GRAIN;
+    int hc = hb - (b->color == BLACK);
+    Node* l1;
+    Node* r1;
+    Node* dup;
+    int hl1, hr1;
+
+    split(a, ha, b->value, l1, hl1, r1, hr1, dup);
+
+    if (dup != 0)
+    {
+        dup->left = dup->right = nil;
+        drop(dup, dropped);
+    }
+
+    Node* left;
+    Node* right;
+    int hleft, hright;
+
+    if (parallel)
+    {
+        Node* leftDropped = nil;
+        std::thread worker([&]() {
+            left = unite(l1, hl1, b->left, hc, hleft, leftDropped, threads / 2);
+        });
+
+        right = unite(r1, hr1, b->right, hc, hright, dropped, threads - threads / 2);
+        worker.join();
+        append(leftDropped, dropped);
+    }
+    else
+    {
+        left = unite(l1, hl1, b->left, hc, hleft, dropped, 1);
+        right = unite(r1, hr1, b->right, hc, hright, dropped, 1);
+    }
+
+    return join(left, hleft, b, right, hright, h);
+}
+
+//Interseção: a raiz de b só continua se o split de a a encontrou
+Node* RBTree::intersect(Node* a, int ha, Node* b, int hb, int& h, Node*& dropped, int threads) const
+{
+    if (a == nil || b == nil)
+    {
+        drop(a, dropped);
+        drop(b, dropped);
+        h = 0;
+        return nil;
+    }
+
+    bool parallel = threads > 1 && a->count + b->count >= PARALLEL_GRAIN;
+    int hc = hb - (b->color == BLACK);
+    Node* bl = b->left;
+    Node* br = b->right;
+    Node* l1;
+    Node* r1;
+    Node* dup;
+    int hl1, hr1;
+
+    split(a, ha, b->value, l1, hl1, r1, hr1, dup);
+
+    Node* left;
+    Node* right;
+    int hleft, hright;
+
+    if (parallel)
+    {
+        Node* leftDropped = nil;
+        std::thread worker([&]() {
+            left = intersect(l1, hl1, bl, hc, hleft, leftDropped, threads / 2);
+        });
+
+        right = intersect(r1, hr1, br, hc, hright, dropped, threads - threads / 2);
+        worker.join();
+        append(leftDropped, dropped);
+    }
+    else
+    {
+        left = intersect(l1, hl1, bl, hc, hleft, dropped, 1);
+        right = intersect(r1, hr1, br, hc, hright, dropped, 1);
+    }
+
+    if (dup != 0)
+    {
+        dup->left = dup->right = nil;
+        drop(dup, dropped);
+
+        return join(left, hleft, b, right, hright, h);
+    }
+
+    b->left = b->right = nil;
+    drop(b, dropped);
+
+    return join2(left, hleft, right, hright, h);
+}
+
+//Diferença a - b: a raiz de b e o valor igual de a são descartados
+Node* RBTree::subtract(Node* a, int ha, Node* b, int hb, int& h, Node*& dropped, int threads) const
+{
+    if (a == nil || b == nil)
+    {
+        drop(b, dropped);
+        h = ha;
+        return a;
+    }
+
+    bool parallel = threads > 1 && a->count + b->count >= PARALLEL_GRAIN;
+    int hc = hb - (b->color == BLACK);
+    Node* bl = b->left;
+    Node* br = b->right;
+    Node* l1;
+    Node* r1;
+    Node* dup;
+    int hl1, hr1;
+
+    split(a, ha, b->value, l1, hl1, r1, hr1, dup);
+
+    if (dup != 0)
+    {
+        dup->left = dup->right = nil;
+        drop(dup, dropped);
+    }
+
+    Node* left;
+    Node* right;
+    int hleft, hright;
+
+    if (parallel)
+    {
+        Node* leftDropped = nil;
+        std::thread worker([&]() {
+            left = subtract(l1, hl1, bl, hc, hleft, leftDropped, threads / 2);
+        });
+
+        right = subtract(r1, hr1, br, hc, hright, dropped, threads - threads / 2);
+        worker.join();
+        append(leftDropped, dropped);
+    }
+    else
+    {
+        left = subtract(l1, hl1, bl, hc, hleft, dropped, 1);
+        right = subtract(r1, hr1, br, hc, hright, dropped, 1);
+    }
+
+    b->left = b->right = nil;
+    drop(b, dropped);
+
+    return join2(left, hleft, right, hright, h);
+}
+
+//Copia uma subárvore de outra árvore para o pool desta
+Node* RBTree::copyTree(const RBTree& from, Node* node)
+{
+    if (node == from.nil)
+        return nil;
+
+    Node* copy = pool.create(node->value);
+
+    copy->color = node->color;
+    copy->count = node->count;
+    copy->left = copyTree(from, node->left);
+    copy->right = copyTree(from, node->right);
+
+    if (copy->left != nil)
+        copy->left->parent = copy;
+
+    if (copy->right != nil)
+        copy->right->parent = copy;
+
+    return copy;
+}
+
+//Instala o resultado de uma operação como a árvore inteira
+void RBTree::setRoot(Node* node)
+{
+    root = node;
+
+    if (root != nil)
+    {
+        root->parent = nil;
+        root->color = BLACK;
+    }
+}
+
+void RBTree::releaseDropped(Node* dropped)
+{
+    while (dropped != nil)
+    {
+        Node* next = dropped->parent;
+
+        deleteTree(dropped);
+        dropped = next;
+    }
+}
+
+//Troca o conteúdo das duas árvores, com os seus pools e os seus nil
+void RBTree::swap(RBTree& other)
+{
+    std::swap(nil, other.nil);
+    std::swap(root, other.root);
+    pool.swap(other.pool);
+}
+
+//O split em si custa O(log n), mas cada árvore tem o seu pool, então a
+//parte menor é copiada para o pool da outra árvore (trocando as
+//árvores, se for o caso) e liberada deste
+bool RBTree::split(int value, RBTree& greater)
+{
+    //greater tem de estar vazia
+    if (&greater == this || greater.root != greater.nil)
+        return false;
+
+    Node* l;
+    Node* r;
+    Node* found;
+    int hl, hr;
+
+    split(root, joinHeight(root), value, l, hl, r, hr, found);
+
+    //O próprio value fica do lado dos menores
+    if (found != 0)
+        l = join(l, hl, found, nil, 0, hl);
+
+    if (r->count <= l->count)
+    {
+        greater.setRoot(greater.copyTree(*this, r));
+        deleteTree(r);
+        setRoot(l);
+    }
+    else
+    {
+        greater.setRoot(greater.copyTree(*this, l));
+        deleteTree(l);
+        setRoot(r);
+        swap(greater);
+    }
+
+    return true;
+}
+
+//Como no split, a árvore menor é copiada para o pool da maior antes
+//do join de O(log n)
+bool RBTree::join(RBTree& other)
+{
+    if (&other == this)
+        return false;
+
+    if (root != nil && other.root != other.nil && maximum(root)->value >= other.minimum(other.root)->value)
+        return false;
+
+    int h;
+
+    if (other.root->count <= root->count)
+    {
+        Node* copy = copyTree(other, other.root);
+
+        other.deleteTree(other.root);
+        other.setRoot(other.nil);
+        setRoot(join2(root, joinHeight(root), copy, joinHeight(copy), h));
+    }
+    else
+    {
+        Node* copy = other.copyTree(*this, root);
+
+        deleteTree(root);
+        setRoot(nil);
+        swap(other);
+        setRoot(join2(copy, joinHeight(copy), root, joinHeight(root), h));
+    }
+
+    return true;
+}
+
+//Nas operações de conjunto, os nós de other são copiados para o pool
+//desta árvore (O(m)) e a recursão usa os próprios nós como pivôs
+void RBTree::unite(const RBTree& other, int numThreads)
+{
+    Node* b = copyTree(other, other.root);
+    Node* dropped = nil;
+    int h;
+
+    setRoot(unite(root, joinHeight(root), b, joinHeight(b), h, dropped, numThreads));
+    releaseDropped(dropped);
+}
+
+void RBTree::intersect(const RBTree& other, int numThreads)
+{
+    Node* b = copyTree(other, other.root);
+    Node* dropped = nil;
+    int h;
+
+    setRoot(intersect(root, joinHeight(root), b, joinHeight(b), h, dropped, numThreads));
+    releaseDropped(dropped);
+}
+
+void RBTree::subtract(const RBTree& other, int numThreads)
+{
+    Node* b = copyTree(other, other.root);
+    Node* dropped = nil;
+    int h;
+
+    setRoot(subtract(root, joinHeight(root), b, joinHeight(b), h, dropped, numThreads));
+    releaseDropped(dropped);
+}
+
+bool RBTree::saveSnapshot(const char* fileName)
+{
+    FILE* out = fopen(fileName, "wb");
+
+    if (out == 0)
+    {
+        printf("Erro ao abrir o arquivo %s\n", fileName);
+        return false;
+    }
+
+    SnapshotWriter writer(out);
+
+    writer.write(TREE_SNAPSHOT_MAGIC);
+    writer.write(root->count);
+
+    traverseInOrder(root, nil, [&](Node* node, int) {
+        writer.write(node->value);
+    });
+
+    bool ok = writer.finish();
+
+    if (fclose(out) != 0)
+        ok = false;
+
+    return ok;
+}
+
+//Retorna false se o arquivo não existir ou não for uma fotografia
+//válida; nesse caso a árvore fica vazia
+bool RBTree::loadSnapshot(const char* fileName)
+{
+    FILE* in = fopen(fileName, "rb");
+
+    if (in == 0)
+    {
+        printf("Erro ao abrir o arquivo %s\n", fileName);
+        return false;
+    }
+
+    //O tamanho do arquivo tem de bater com o cabeçalho
+    fseek(in, 0, SEEK_END);
+    long length = ftell(in);
+    rewind(in);
+
+    SnapshotReader reader(in);
+    int magic = reader.read();
+    int n = reader.read();
+
+    deleteTree(root);
+    setRoot(nil);
+
+    if (reader.failed() || magic != TREE_SNAPSHOT_MAGIC || n < 0 ||
+        length != (TREE_SNAPSHOT_HEADER + (long) n) * (long) sizeof(int))
+    {
+        fclose(in);
+        return false;
+    }
+
+    //Na árvore perfeitamente balanceada, os caminhos até o nil têm
+    //deepest ou deepest + 1 nós; os nós do nível mais fundo ficam
+    //vermelhos e todos os caminhos passam pelo mesmo número de pretos
+    int deepest = 0;
+
+    for (int m = n; m > 1; m >>= 1)
+        deepest++;
+
+    long previous = (long) INT_MIN - 1;
+    bool sorted = true;
+
+    setRoot(restore(reader, n, 0, deepest, previous, sorted));
+
+    fclose(in);
+
+    if (!sorted || reader.failed())
+    {
+        deleteTree(root);
+        setRoot(nil);
+
+        return false;
+    }
+
+    return true;
+}
+
+//Monta a subárvore perfeitamente balanceada com os próximos n valores,
+//com a raiz na profundidade depth
+Node* RBTree::restore(SnapshotReader& in, int n, int depth, int deepest, long& previous, bool& sorted)
+{
+    if (n == 0)
+        return nil;
+
+    int leftCount = (n - 1) / 2;
+    Node* left = restore(in, leftCount, depth + 1, deepest, previous, sorted);
+    int value = in.read();
+
+    if (value <= previous)
+        sorted = false;
+
+    previous = value;
+
+    Node* node = pool.create(value);
+    Node* right = restore(in, n - 1 - leftCount, depth + 1, deepest, previous, sorted);
+
+    makeNode(left, node, right, depth == deepest && depth > 0 ? RED : BLACK);
+
+    return node;
+}
@@ -0,0 +1,189 @@
+#include <iostream>
+#include "../NodePool.h"
+#include "../Traversal.h"
+#include "../TreeSnapshot.h"
+
+using namespace std;
+
+#define RED   0
+#define BLACK 1
+
+//Tamanho mínimo (nós das duas árvores) para que as operações de
+//conjunto dividam a recursão com outra thread
+#define PARALLEL_GRAIN 65536
+
+class Node 
+{
+    public:
+        Node* left;
+        Node* right;
+        Node* parent;
+        int value;
+        int color;
+        int count; //nós da subárvore, contando este; 0 no nil
+
+        Node();
+        Node(int);
+};
+
+class RBTree 
+{
+    private:
+        
+        Node* nil;
+        NodePool<Node> pool; //todos os nós da árvore, exceto nil
+
+        void leftRotation(Node*);
+        void rightRotation(Node*);
+        Node* successor(Node*);
+        void print(Node*);
+        void insertFixUp(Node*&);
+        void removeFixUp(Node*&);
+        void deleteTree(Node*);
+        Node* minimum(Node*) const;
+        Node* maximum(Node*) const;
+        Node* next(Node*) const;
+        Node* previous(Node*) const;
+
+        //Operações baseadas em join sobre subárvores soltas. As alturas
+        //passadas e devolvidas são as de joinHeight; os nós descartados
+        //são encadeados por parent em dropped e liberados no fim
+        int joinHeight(Node*) const;
+        Node* makeNode(Node*, Node*, Node*, int) const;
+        Node* rotateLeft(Node*) const;
+        Node* rotateRight(Node*) const;
+        Node* joinRight(Node*, int, Node*, Node*, int) const;
+        Node* joinLeft(Node*, int, Node*, Node*, int) const;
+        Node* join(Node*, int, Node*, Node*, int, int&) const;
+        Node* join2(Node*, int, Node*, int, int&) const;
+        Node* splitLast(Node*, int, Node*&, int&) const;
+        void split(Node*, int, int, Node*&, int&, Node*&, int&, Node*&) const;
+        void drop(Node*, Node*&) const;
+        void append(Node*, Node*&) const;
+        Node* unite(Node*, int, Node*, int, int&, Node*&, int) const;
+        Node* intersect(Node*, int, Node*, int, int&, Node*&, int) const;
+        Node* subtract(Node*, int, Node*, int, int&, Node*&, int) const;
+        Node* copyTree(const RBTree&, Node*);
+        void setRoot(Node*);
+        void releaseDropped(Node*);
+        void swap(RBTree&);
+        Node* restore(SnapshotReader&, int, int, int, long&, bool&);
+
+    public:
+		Node* root;
+        RBTree();
+        ~RBTree();
+
+        bool insert(int);
+        bool remove(int);
+        bool contains(int);
+
+        void print();
+        int size() const;
+        bool isEmpty() const;
+        long memoryUsage() const;
+        
+        int blackHeight(Node*);
+
+        //Percursos sem recursão, que chamam visit(node, depth)
+        template <class Visitor>
+        void visitPreOrder(Visitor visit)
+        {
+            traversePreOrder(root, nil, visit);
+        }
+
+        template <class Visitor>
+        void visitInOrder(Visitor visit)
+        {
+            traverseInOrder(root, nil, visit);
+        }
+
+        template <class Visitor>
+        void visitPosOrder(Visitor visit)
+        {
+            traversePosOrder(root, nil, visit);
+        }
+
+        //Move para greater, que deve estar vazia, os valores maiores
+        //que value; os demais ficam nesta árvore
+        bool split(int, RBTree& greater);
+
+        //Move para esta árvore todos os valores de other, que devem
+        //ser maiores que os daqui; other fica vazia
+        bool join(RBTree& other);
+
+        //Operações de conjunto com other, que não é alterada; o
+        //resultado fica nesta árvore. Com numThreads > 1 as duas
+        //metades da recursão rodam em paralelo
+        void unite(const RBTree& other, int numThreads = 1);
+        void intersect(const RBTree& other, int numThreads = 1);
+        void subtract(const RBTree& other, int numThreads = 1);
+
+        //Grava e carrega a árvore no formato de TreeSnapshot.h; a carga
+        //substitui o conteúdo atual
+        bool saveSnapshot(const char*);
+        bool loadSnapshot(const char*);
+
+        //Iterador bidirecional em ordem crescente, que sobe pelos
+        //ponteiros parent; end() é o nil. Continua válido enquanto o
+        //nó a que aponta não for removido
+        class Iterator
+        {
+            private:
+                const RBTree* tree;
+                Node* node;
+
+            public:
+                Iterator(const RBTree* tree, Node* node)
+                {
+                    this->tree = tree;
+                    this->node = node;
+                }
+
+                const int& operator*() const
+                {
+                    return node->value;
+                }
+
+                Iterator& operator++()
+                {
+                    node = tree->next(node);
+                    return *this;
+                }
+
+                //Decrementar end() leva ao maior valor
+                Iterator& operator--()
+                {
+                    node = tree->previous(node);
+                    return *this;
+                }
+
+                bool operator==(const Iterator& other) const
+                {
+                    return node == other.node;
+                }
+
+                bool operator!=(const Iterator& other) const
+                {
+                    return node != other.node;
+                }
+        };
+
+        Iterator begin() const;
+        Iterator end() const;
+        Iterator lowerBound(int) const;  //primeiro valor >= x
+        Iterator upperBound(int) const;  //primeiro valor > x
+
+        //Estatísticas de ordem, em O(log n)
+        Iterator select(int) const;  //k-ésimo menor, a partir de 0; end() se não houver
+        int rank(int) const;         //quantidade de valores menores que x
+
+        //Chama visit(valor) para cada valor em [lo, hi], em ordem
+        //crescente, em O(log n + k)
+        template <class Visitor>
+        void range(int lo, int hi, Visitor visit) const
+        {
+            for (Iterator it = lowerBound(lo); it != end() && *it <= hi; ++it)
+                visit(*it);
+        }
+};
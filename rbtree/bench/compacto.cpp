@@ -0,0 +1,64 @@
+//Compara a RBTree com a CompactRBTree sobre n inteiros sorteados:
+//memória por chave (os blocos efetivamente alocados, incluindo a
+//folga do último), tempo de inserção e tempo de busca.
+//
+//Compilação, a partir do diretório rbtree:
+//  g++ -std=c++11 -O2 -I. bench/compacto.cpp RBTree.cpp CompactRBTree.cpp -o compacto
+//
+//Uso: compacto [quantidade de chaves]
+
+#include <stdlib.h>
+#include <chrono>
+#include "RBTree.h"
+#include "CompactRBTree.h"
+#include "../../Bench.h"
+
+int main(int argc, char** argv)
+{
+    int n = argc > 1 ? atoi(argv[1]) : 2000000;
+    int achados = 0;
+
+    cout << n << " chaves" << endl;
+
+    RBTree* rb = new RBTree();
+
+    semente = 5;
+    std::chrono::steady_clock::time_point inicio = agora();
+    for (int i = 0; i < n; i++)
+        rb->insert(proximo());
+    cout << "RBTree insert:          " << segundos(inicio) << " s" << endl;
+
+    semente = 5;
+    inicio = agora();
+    for (int i = 0; i < n; i++)
+        achados += rb->contains(proximo());
+    cout << "RBTree contains:        " << segundos(inicio) << " s" << endl;
+
+    cout << "RBTree bytes/chave:     " << (double) rb->memoryUsage() / rb->size()
+         << " (" << sizeof(Node) << " por nó)" << endl;
+
+    delete rb;
+
+    CompactRBTree* compacta = new CompactRBTree();
+
+    semente = 5;
+    inicio = agora();
+    for (int i = 0; i < n; i++)
+        compacta->insert(proximo());
+    cout << "CompactRBTree insert:   " << segundos(inicio) << " s" << endl;
+
+    semente = 5;
+    inicio = agora();
+    for (int i = 0; i < n; i++)
+        achados += compacta->contains(proximo());
+    cout << "CompactRBTree contains: " << segundos(inicio) << " s" << endl;
+
+    cout << "CompactRBTree bytes/chave: " << (double) compacta->memoryUsage() / compacta->size()
+         << " (" << sizeof(CompactNode) << " por nó)" << endl;
+
+    delete compacta;
+
+    cout << achados << " buscas com sucesso" << endl;
+
+    return 0;
+}
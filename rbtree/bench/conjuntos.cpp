@@ -0,0 +1,84 @@
+//Compara a união de duas RBTree de n chaves sorteadas feita chave a
+//chave (insert de cada valor da outra árvore) com unite, sequencial e
+//com threads, e mede também intersect e subtract.
+//
+//Compilação, a partir do diretório rbtree:
+//  g++ -std=c++11 -O2 -pthread -I. bench/conjuntos.cpp RBTree.cpp -o conjuntos
+//
+//Uso: conjuntos [chaves por árvore] [threads]
+
+#include <stdlib.h>
+#include <chrono>
+#include <thread>
+#include "RBTree.h"
+#include "../../Bench.h"
+
+//Duas árvores com metade das chaves em comum
+static void preencher(RBTree& a, RBTree& b, int n)
+{
+    semente = 17;
+
+    for (int i = 0; i < n; i++)
+    {
+        int v = proximo();
+
+        a.insert(v);
+        b.insert(i % 2 == 0 ? v : proximo());
+    }
+}
+
+int main(int argc, char** argv)
+{
+    int n = argc > 1 ? atoi(argv[1]) : 1000000;
+    int numThreads = argc > 2 ? atoi(argv[2]) : (int) std::thread::hardware_concurrency();
+
+    cout << n << " chaves por árvore, " << numThreads << " threads" << endl;
+
+    {
+        RBTree a, b;
+        preencher(a, b, n);
+
+        std::chrono::steady_clock::time_point inicio = agora();
+        for (RBTree::Iterator it = b.begin(); it != b.end(); ++it)
+            a.insert(*it);
+        cout << "insert chave a chave:  " << segundos(inicio) << " s\t(" << a.size() << ")" << endl;
+    }
+
+    {
+        RBTree a, b;
+        preencher(a, b, n);
+
+        std::chrono::steady_clock::time_point inicio = agora();
+        a.unite(b);
+        cout << "unite:                 " << segundos(inicio) << " s\t(" << a.size() << ")" << endl;
+    }
+
+    {
+        RBTree a, b;
+        preencher(a, b, n);
+
+        std::chrono::steady_clock::time_point inicio = agora();
+        a.unite(b, numThreads);
+        cout << "unite paralelo:        " << segundos(inicio) << " s\t(" << a.size() << ")" << endl;
+    }
+
+    {
+        RBTree a, b;
+        preencher(a, b, n);
+
+        std::chrono::steady_clock::time_point inicio = agora();
+        a.intersect(b, numThreads);
+        cout << "intersect paralelo:    " << segundos(inicio) << " s\t(" << a.size() << ")" << endl;
+    }
+
+    {
+        RBTree a, b;
+        preencher(a, b, n);
+
+        std::chrono::steady_clock::time_point inicio = agora();
+        a.subtract(b, numThreads);
+        cout << "subtract paralelo:     " << segundos(inicio) << " s\t(" << a.size() << ")" << endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,50 @@
+//Compara a partida a frio de uma RBTree de n chaves sorteadas refeita
+//com um insert por chave (como ao reler um log de valores) com a carga
+//de uma fotografia gravada por saveSnapshot.
+//
+//Compilação, a partir do diretório rbtree:
+//  g++ -std=c++11 -O2 -pthread -I. bench/fotografia.cpp RBTree.cpp -o fotografia
+//
+//Uso: fotografia [chaves] [arquivo]
+
+#include <stdlib.h>
+#include <chrono>
+#include "RBTree.h"
+#include "../../Bench.h"
+
+int main(int argc, char** argv)
+{
+    int n = argc > 1 ? atoi(argv[1]) : 1000000;
+    const char* arquivo = argc > 2 ? argv[2] : "fotografia.snap";
+
+    cout << n << " chaves" << endl;
+
+    {
+        RBTree a;
+        semente = 17;
+
+        std::chrono::steady_clock::time_point inicio = agora();
+        for (int i = 0; i < n; i++)
+            a.insert(proximo());
+        cout << "insert chave a chave:  " << segundos(inicio) << " s\t(" << a.size() << ")" << endl;
+
+        inicio = agora();
+        if (!a.saveSnapshot(arquivo))
+            return 1;
+        cout << "saveSnapshot:          " << segundos(inicio) << " s" << endl;
+    }
+
+    {
+        RBTree b;
+
+        std::chrono::steady_clock::time_point inicio = agora();
+        if (!b.loadSnapshot(arquivo))
+            return 1;
+        cout << "loadSnapshot:          " << segundos(inicio) << " s\t(" << b.size() << ", altura negra "
+             << b.blackHeight(b.root) << ")" << endl;
+    }
+
+    remove(arquivo);
+
+    return 0;
+}